@@ -15,11 +15,24 @@
 #include "hardware/timer.h"           // Biblioteca para gerenciamento de temporizadores
 #include "ws2812.pio.h"               // Biblioteca PIO para controle de LEDs WS2812
 #include "hardware/pwm.h"             // Biblioteca para interface PWM
+#include "hardware/uart.h"            // Biblioteca para o enlace versus via UART
+#include "hardware/irq.h"             // Interrupção de recepção da UART do enlace
+#include "pico/unique_id.h"           // ID único da placa (papel no modo versus)
+#include "pico/stdio_usb.h"           // Saída USB sem conversão de fim de linha (espelho)
+#include "tusb.h"                     // Espaço livre no CDC da USB (espelho)
 
 #define SMOOTHING_FACTOR 0.8 // Fator de suavização para a leitura do joystick (0.0 a 1.0)
 
 #include "inc/ssd1306.h"
-#include "inc/font.h"
+#include "inc/render.h"
+#include "inc/menu.h"
+#include "inc/link.h"
+#include "inc/versus.h"
+#include "inc/mirror.h"
+#include "inc/anim.h"
+#include "inc/effects.h"
+#include "inc/audio.h"
+#include "inc/sounds.h"
 
 /* Configurações do Joystick */
 #define EIXO_Y 26    // Pino ADC para o eixo Y do joystick
@@ -30,6 +43,7 @@ float smoothed_value = 0; // Valor suavizado da leitura do joystick
 /* Configurações da Matriz de LEDs */
 #define LED_PIN 7              // Pino de controle dos LEDs
 #define LED_COUNT 25           // Número total de LEDs na matriz
+#define LED_SCALE(level) ((level) * 51 / 8) // Brilho 1 a 5 -> escala de 6 a 31: o 80 das cores sai como ~10, como antes
 
 
 /* Configurações do I2C */
@@ -38,10 +52,63 @@ float smoothed_value = 0; // Valor suavizado da leitura do joystick
 #define I2C_SCL 15             // Pino SCL para comunicação I2C
 
 
+/* Configurações do enlace versus (UART0 nos pinos GP16/GP17 do expansor) */
+#define LINK_UART uart0        // UART ligada à outra placa
+#define LINK_TX 16             // Pino TX (ligar ao RX da outra placa)
+#define LINK_RX 17             // Pino RX (ligar ao TX da outra placa)
+#define LINK_BAUD 115200       // 8 bytes por quadro: ~0,7 ms no fio
+#define LINK_DELAY 2           // Atraso de entrada em ticks (40 ms)
+#define LINK_LEAVE_US 200000   // Espera máxima pelas confirmações ao sair da partida
+#define LINK_RX_BUFFER 256     // Fila de recepção preenchida pela interrupção (potência de 2)
+
+
 /* Configurações do Display */
 #define DISPLAY_WIDTH 128      // Largura do display em pixels
 #define DISPLAY_HEIGHT 64      // Altura do display em pixels
+#define HUD_ROWS 16            // Linhas fixas do placar (páginas 0 e 1)
+#define STAR_ROWS 8            // Faixa de estrelas rolada por hardware (página 2)
+#define STAR_COUNT 16          // Quantidade de estrelas no fundo
+#define FIELD_FIRST_PAGE 3     // Primeira página do campo de jogo
+#define FIELD_LAST_PAGE 7      // Última página do campo de jogo
+#define FRAME_MS 20            // Período do quadro (50 FPS)
 ssd1306_t ssd;                // Estrutura para o display SSD1306
+i2c_sched_t i2c_bus;          // Fila de transações do I2C1 (display e periféricos do expansor)
+render_t field;               // Renderizador do campo de jogo no OLED
+
+
+/* Sprites do campo de jogo (colunas de 8 linhas, bit 0 em cima) */
+#define SHIP_Y 56              // Linha da nave do jogador
+#define ENEMY_Y 24             // Linha do inimigo
+#define SHOT_SPEED 4           // Pixels por quadro dos disparos
+#define MAX_SHOTS 32           // Disparos simultâneos na tela
+#define BOOM_FRAMES 10         // Quadros da explosão ao acertar o inimigo
+
+static const uint8_t ship_image[] = {0xc0, 0xf0, 0x60, 0x60, 0xfc, 0x7f, 0xfc, 0x60, 0x60, 0xf0, 0xc0};
+static const uint8_t ship_mask[]  = {0xf0, 0xf8, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xf8, 0xf0};
+static const uint8_t enemy_image[] = {0x03, 0x06, 0x0f, 0x15, 0x3f, 0x7f, 0x3f, 0x15, 0x0f, 0x06, 0x03};
+static const uint8_t enemy_mask[]  = {0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07};
+static const uint8_t shot_image[] = {0x0f};
+static const uint8_t boom_image[] = {0x11, 0xaa, 0x44, 0xaa, 0x11, 0xaa, 0x44, 0xaa, 0x11};
+static const uint8_t boom_mask[]  = {0xbb, 0xff, 0xee, 0xff, 0xbb, 0xff, 0xee, 0xff, 0xbb};
+
+static const sprite_t ship_sprite = {11, 8, ship_image, ship_mask};
+static const sprite_t enemy_sprite = {11, 8, enemy_image, enemy_mask};
+static const sprite_t shot_sprite = {1, 4, shot_image, shot_image};
+static const sprite_t boom_sprite = {9, 8, boom_image, boom_mask};
+
+typedef struct {
+    int16_t x, y;
+} shot_t;
+
+
+/* Converte a posição da faixa (1 a 5) na coluna central do OLED */
+static inline int16_t lane_to_x(float lane) {
+    return 12 + (int16_t)((lane - 1) * 26);
+}
+
+shot_t shots[MAX_SHOTS];           // Disparos em voo no OLED
+uint8_t shot_count = 0;            // Quantidade de disparos em voo
+uint8_t boom_frames = 0;           // Quadros restantes da explosão
 
 
 // Frequências das notas musicais em Hertz
@@ -69,6 +136,26 @@ Si (B) - 247.500 Hz
 #define BUZZER_A 21 // Define o pino GPIO 21 como o pino conectado ao buzzer A
 #define BUZZER_B 10 // Define o pino GPIO 10 como o pino conectado ao buzzer B
 
+// Vozes do mixer de áudio
+#define VOICE_MUSIC 0   // Músicas (onda quadrada)
+#define VOICE_SHOT 1    // Disparos
+#define VOICE_BOOM 2    // Explosões
+#define VOICE_HIT 3     // Jogador atingido
+
+audio_t audio;          // Motor de áudio (PWM + DMA nos dois buzzers)
+
+static const audio_note_t intro_song[] = {
+    {DO, 250}, {0, 250}, {FA, 250}, {0, 250}, {SI, 250}, {0, 250}
+};
+
+static const audio_note_t game_song[] = { // Baixo em loop durante a partida
+    {DO / 2, 200}, {0, 50}, {DO / 2, 200}, {0, 50}, {SOL / 2, 200}, {0, 50}, {FA / 2, 200}, {0, 50}
+};
+
+static const audio_note_t game_over_song[] = {
+    {SOL, 150}, {FA, 150}, {MI, 150}, {DO, 400}
+};
+
 
 /* Configurações dos Botões */
 const uint BUTTON_A = 5; // Pino GPIO do botão A
@@ -77,28 +164,58 @@ static volatile uint32_t last_time = 0; // Armazena o tempo do último clique de
 
 
 /* Estado do Jogo */
-uint8_t screen = 0;                // Tela atual do display (0 = menu, 1 = sobre, 2 = placar)
-uint8_t menu = 0;                  // Opção do menu selecionada
+typedef enum {
+    STATE_MENU,                    // Navegando pelo menu (inclui as telas fixas)
+    STATE_GAME                     // Partida em andamento
+} game_state_t;
+
+volatile game_state_t state = STATE_MENU; // Estado atual da máquina de telas
 volatile uint8_t e_position = 3;   // Posição do inimigo
 volatile bool vivo = true;         // Estado do jogador (vivo ou morto)
-volatile bool play = false;        // Estado do jogo (em execução ou pausado)
 volatile bool disparo_em_andamento = false; // Indica se um disparo está em andamento
 volatile uint16_t score = 0;       // Pontuação do jogador
+uint8_t brightness = 5;            // Brilho do OLED e dos LEDs (1 a 5)
+volatile bool versus = false;      // Partida contra outra placa (o inimigo é o segundo jogador)
+bool fire_pending = false;         // Disparo aguardando o próximo tick do enlace
+link_t link;                       // Enlace lockstep com a outra placa
+uint8_t mirroring = 0;             // Espelho do OLED e dos LEDs pela USB (0 ou 1)
+mirror_t mirror;                   // Estado do espelho (cópia do que o visualizador tem)
+versus_t duel;                     // Estado da partida versus (igual nas duas placas)
+uint16_t high_scores[3] = {0};     // Melhores pontuações da sessão
+
+
+/* Fila de eventos dos botões: a interrupção só registra, o laço principal trata */
+#define EVENT_QUEUE_SIZE 8
+
+typedef enum {
+    EVENT_BUTTON_A,
+    EVENT_BUTTON_B
+} button_event_t;
+
+static volatile uint8_t event_queue[EVENT_QUEUE_SIZE];
+static volatile uint8_t event_head = 0; // Escrito apenas pela interrupção
+static volatile uint8_t event_tail = 0; // Escrito apenas pelo laço principal
 
 
 /* Função para mapear valores de uma faixa para outra */
-int map_value(float value, float in_min, float in_max, int out_min, int out_max) {
+int __not_in_flash_func(map_value)(float value, float in_min, float in_max, int out_min, int out_max) {
     return (int)((value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min); // Retorna o valor mapeado
 }
 
 
 /* Protótipos das funções */
-void nota(uint32_t frequencia, uint32_t tempo_ms); // Função para tocar notas
 void PLAYER();                                     // Função para controlar o jogador
 void ENEMY();                                      // Função para controlar o inimigo
-void menu_interface();                             // Função para exibir a interface do menu
 void score_display();                              // Função para exibir a pontuação
-void menu_select();                                // Função para selecionar opções do menu
+void game_interface();                             // Função para exibir a tela do jogo
+void game_render();                                // Função para desenhar um quadro do jogo
+void game_start();                                 // Função para iniciar uma partida
+void game_end();                                   // Função para encerrar a partida e voltar ao menu
+void game_fire();                                  // Função para disparar contra o inimigo
+void versus_start();                               // Função para iniciar uma partida contra outra placa
+bool versus_tick();                                // Função para avançar um tick do modo versus
+void frame_wait(absolute_time_t next_frame);       // Função para aguardar o próximo quadro
+menu_event_t joystick_event();                     // Função para converter o joystick em eventos do menu
 bool repeating_timer_callback();                   // Função de callback do temporizador
 void gpio_irq_handler(uint gpio, uint32_t events); // Função de interrupção para os botões
 
@@ -113,7 +230,10 @@ typedef struct pixel_t pixel_t;   // Alias para a estrutura pixel_t
 typedef pixel_t npLED_t;          // Alias para facilitar o uso no contexto de LEDs
 
 
-npLED_t leds[LED_COUNT]; // Array para armazenar o estado de cada LED na matriz
+/* Rotinas executadas a cada quadro (LEDs e filtro do joystick) ficam na SRAM
+   com __not_in_flash_func para evitar jitter por falhas de cache do XIP */
+npLED_t leds[LED_COUNT]; // Array para armazenar o estado de cada LED na matriz (camada do jogo)
+anim_t anim;             // Motor de animação: compõe os LEDs com os efeitos e envia por DMA
 PIO np_pio;              // Variável para referenciar a instância PIO usada para controle de LEDs
 uint sm;                 // Variável para armazenar o número da máquina de estado (State Machine)
 
@@ -133,29 +253,13 @@ void npInit(uint pin) {
         leds[i].G = 0; // Componente verde
         leds[i].B = 0; // Componente azul
     }
-}
 
-// Função para configurar PWM no pino especificado
-void configure_pwm(uint gpio) {
-    gpio_set_function(gpio, GPIO_FUNC_PWM);
-    uint slice_num = pwm_gpio_to_slice_num(gpio);
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, 4.0f);  // Define a divisão do clock
-    pwm_init(slice_num, &config, true);
+    // A partir daqui a matriz é atualizada pelo temporizador do motor de animação
+    anim_init(&anim, np_pio, sm, (const uint8_t *)leds, LED_SCALE(brightness));
 }
 
-/* Função para atualizar os LEDs no hardware */
-void npUpdate() {
-    for (uint i = 0; i < LED_COUNT; ++i) { // Iterar sobre todos os LEDs
-        pio_sm_put_blocking(np_pio, sm, leds[i].G); // Enviar componente Verde
-        pio_sm_put_blocking(np_pio, sm, leds[i].R); // Enviar componente Vermelho        
-        pio_sm_put_blocking(np_pio, sm, leds[i].B); // Enviar componente Azul
-    }
-}
-
-
 /* Função para definir a cor de um LED específico */
-void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t b) {
+void __not_in_flash_func(npSetLED)(const uint index, const uint8_t r, const uint8_t g, const uint8_t b) {
     leds[index].R = r; // Definir componente vermelho
     leds[index].G = g; // Definir componente verde
     leds[index].B = b; // Definir componente azul
@@ -163,14 +267,14 @@ void npSetLED(const uint index, const uint8_t r, const uint8_t g, const uint8_t
 
 
 /* Função para limpar (apagar) todos os LEDs */
-void npClear() {
+void __not_in_flash_func(npClear)() {
     for (uint i = 0; i < LED_COUNT; ++i) // Iterar sobre todos os LEDs
         npSetLED(i, 0, 0, 0);            // Definir cor como preta (apagado)
 }
 
 
 /* Função para definir a posição do jogador na matriz de LEDs */
-void matrixSetPlayer(int position, const uint8_t r, const uint8_t g, const uint8_t b) {
+void __not_in_flash_func(matrixSetPlayer)(int position, const uint8_t r, const uint8_t g, const uint8_t b) {
     /* Gabarito do Display
     24, 23, 22, 21, 20
     15, 16, 17, 18, 19
@@ -221,7 +325,7 @@ void matrixSetPlayer(int position, const uint8_t r, const uint8_t g, const uint8
 
 
 /* Função para definir a posição do inimigo na matriz de LEDs */
-void matrixSetEnemy(int position, const uint8_t r, const uint8_t g, const uint8_t b) {    
+void __not_in_flash_func(matrixSetEnemy)(int position, const uint8_t r, const uint8_t g, const uint8_t b) {    
     /* Gabarito do Display
     24, 23, 22, 21, 20
     15, 16, 17, 18, 19
@@ -273,7 +377,7 @@ void matrixSetEnemy(int position, const uint8_t r, const uint8_t g, const uint8_
 
 
 /* Função para desenhar o tiro do jogador na matriz de LEDs */
-void shot_player(int position, const uint8_t r, const uint8_t g, const uint8_t b) {
+void __not_in_flash_func(shot_player)(int position, const uint8_t r, const uint8_t g, const uint8_t b) {
     /* Gabarito do Display
     24, 23, 22, 21, 20
     15, 16, 17, 18, 19
@@ -320,6 +424,168 @@ void shot_player(int position, const uint8_t r, const uint8_t g, const uint8_t b
 
 }
 
+/* Árvore do menu */
+enum {
+    ACTION_NONE,
+    ACTION_PLAY,
+    ACTION_VERSUS,
+    ACTION_BRIGHTNESS,
+    ACTION_MIRROR
+};
+
+menu_t menu;                       // Estado do menu (tela aberta e seleção)
+
+static void about_draw(ssd1306_t *ssd);
+static void scores_draw(ssd1306_t *ssd);
+static const menu_screen_t main_screen;
+
+static const menu_screen_t about_screen = {NULL, NULL, 0, &main_screen, about_draw};
+static const menu_screen_t scores_screen = {"RECORDES", NULL, 0, &main_screen, scores_draw};
+
+static const menu_item_t settings_items[] = {
+    {"BRILHO", NULL, ACTION_BRIGHTNESS, &brightness, 1, 5},
+    {"ESPELHO", NULL, ACTION_MIRROR, &mirroring, 0, 1},
+    {"VOLTAR", &main_screen, ACTION_NONE, NULL, 0, 0},
+};
+static const menu_screen_t settings_screen = {"CONFIG", settings_items, count_of(settings_items), &main_screen, NULL};
+
+static const menu_item_t main_items[] = {
+    {"PLAY", NULL, ACTION_PLAY, NULL, 0, 0},
+    {"VERSUS", NULL, ACTION_VERSUS, NULL, 0, 0},
+    {"RECORDES", &scores_screen, ACTION_NONE, NULL, 0, 0},
+    {"CONFIG", &settings_screen, ACTION_NONE, NULL, 0, 0},
+    {"SOBRE", &about_screen, ACTION_NONE, NULL, 0, 0},
+};
+static const menu_screen_t main_screen = {NULL, main_items, count_of(main_items), NULL, NULL};
+
+
+/* Conteúdo da tela "SOBRE" */
+static void about_draw(ssd1306_t *ssd) {
+    ssd1306_draw_string(ssd, "SPACE WAR", 24, 20);
+    ssd1306_draw_string(ssd, "THIAGOSOUSA81", 12, 30);
+    ssd1306_draw_string(ssd, "EMBARCATECH", 18, 40);
+}
+
+
+/* Conteúdo da tela "RECORDES" */
+static void scores_draw(ssd1306_t *ssd) {
+    char buffer[12];
+    for (uint8_t i = 0; i < count_of(high_scores); i++) {
+        sprintf(buffer, "%u  %u", i + 1, high_scores[i]);
+        ssd1306_draw_string(ssd, buffer, 32, 24 + i * 10);
+    }
+}
+
+
+/* Aplica o brilho escolhido no OLED (contraste) e na composição dos LEDs */
+static void apply_brightness() {
+    ssd1306_command(&ssd, SET_CONTRAST);
+    ssd1306_command(&ssd, brightness * 51);
+    anim.scale = LED_SCALE(brightness);
+}
+
+
+/* Ações disparadas pelas entradas do menu */
+static void menu_action(menu_t *m, const menu_item_t *item) {
+    switch (item->action) {
+        case ACTION_PLAY:
+            game_start();
+            break;
+        case ACTION_VERSUS:
+            versus_start();
+            break;
+        case ACTION_BRIGHTNESS:
+            apply_brightness();
+            break;
+        case ACTION_MIRROR:
+            mirror_request_key(&mirror); // O visualizador recebe a tela inteira
+            break;
+    }
+}
+
+
+/* Registra um evento de botão (chamada pela interrupção) */
+static void event_post(uint8_t event) {
+    uint8_t next = (event_head + 1) % EVENT_QUEUE_SIZE;
+    if (next != event_tail) { // Fila cheia: o evento é descartado
+        event_queue[event_head] = event;
+        event_head = next;
+    }
+}
+
+
+/* Retira o próximo evento de botão da fila (chamada pelo laço principal) */
+static bool event_take(uint8_t *event) {
+    if (event_tail == event_head)
+        return false;
+    *event = event_queue[event_tail];
+    event_tail = (event_tail + 1) % EVENT_QUEUE_SIZE;
+    return true;
+}
+
+
+/* Trata um evento de botão conforme o estado atual */
+static void button_event(uint8_t event) {
+    if (state == STATE_MENU) {
+        menu_handle(&menu, event == EVENT_BUTTON_A ? MENU_EVENT_SELECT : MENU_EVENT_BACK);
+    } else if (event == EVENT_BUTTON_A) {
+        game_end();
+    } else if (versus) {
+        fire_pending = true; // Enviado na entrada do próximo tick
+    } else {
+        game_fire();
+    }
+}
+
+
+/* Transporte do espelho sobre o CDC da USB. O pacote só é escrito quando
+   cabe inteiro no buffer de transmissão, então a escrita nunca bloqueia. */
+static size_t usb_mirror_available(void *ctx) {
+    return tud_cdc_connected() ? tud_cdc_write_available() : 0;
+}
+
+static void usb_mirror_write(void *ctx, const uint8_t *data, size_t len) {
+    stdio_usb.out_chars((const char *)data, len); // Direto no driver: sem conversão \n -> \r\n
+}
+
+
+/* Comandos pela USB: 'M' liga o espelho, 'm' desliga; 'S' lança uma rajada de
+   MAX_SHOTS disparos na partida, para medir o renderizador com dezenas de
+   objetos (o debounce do botão B não deixa passar de uns poucos) */
+static void usb_command() {
+    int c = getchar_timeout_us(0);
+    if (c == 'M') {
+        mirroring = 1;
+        mirror_request_key(&mirror);
+    } else if (c == 'm') {
+        mirroring = 0;
+    } else if (c == 'S' && state == STATE_GAME) {
+        for (shot_count = 0; shot_count < MAX_SHOTS; shot_count++) {
+            shots[shot_count].x = 2 + shot_count * 4;
+            shots[shot_count].y = SHIP_Y - 4 - (shot_count % 8) * 4;
+        }
+    }
+}
+
+
+/* Tempo de desenho + preparo do envio do campo, uma vez por segundo pela USB
+   (só com o espelho desligado, que usa a mesma porta) */
+static void render_report() {
+    static uint32_t last_report = 0;
+    if (mirroring || time_us_32() - last_report < 1000000) {
+        return;
+    }
+    last_report = time_us_32();
+    printf("render: %lu us (max %lu) objetos %u descartados %u envios %lu adiados %lu i2c %lu us\n",
+           (unsigned long)field.frame_us, (unsigned long)field.frame_us_max, field.objects, field.culled,
+           (unsigned long)field.flushes, (unsigned long)field.deferred, (unsigned long)ssd.device.busy_us);
+    field.frame_us_max = 0;
+    field.flushes = 0;
+    field.deferred = 0;
+    ssd.device.busy_us = 0;
+}
+
+
 /* Função principal do programa */
 int main() {
     stdio_init_all(); // Inicializa a biblioteca padrão
@@ -336,6 +602,7 @@ int main() {
     gpio_set_function(I2C_SCL, GPIO_FUNC_I2C); // Configura o pino SCL para I2C
     gpio_pull_up(I2C_SDA); // Habilita o pull-up interno no pino SDA
     gpio_pull_up(I2C_SCL); // Habilita o pull-up interno no pino SCL
+    i2c_sched_init(&i2c_bus, I2C_PORT); // Transações atendidas pela interrupção do I2C
 
     npInit(LED_PIN);  // Inicializa os LEDs
     matrixSetPlayer(3, 0, 80, 80); // Define a posição inicial do jogador
@@ -357,11 +624,14 @@ int main() {
 
 
     /* Iniciando e configurando o Display */    
-    ssd1306_init(&ssd, DISPLAY_WIDTH, DISPLAY_HEIGHT, false, 0x3c, I2C_PORT); // Inicializa o display SSD1306
+    ssd1306_init(&ssd, DISPLAY_WIDTH, DISPLAY_HEIGHT, false, 0x3c, &i2c_bus); // Inicializa o display SSD1306
     ssd1306_config(&ssd); // Configura o display
     ssd1306_fill(&ssd, false); // Limpa o display
     ssd1306_send_data(&ssd); // Envia os dados para o display
-    menu_interface(); // Exibe a interface do menu
+    menu_init(&menu, &ssd, menu_action); // Inicializa o menu
+    static const mirror_transport_t usb_mirror = {usb_mirror_available, usb_mirror_write, NULL};
+    mirror_init(&mirror, &usb_mirror); // Espelho desligado até o visualizador pedir
+    menu_open(&menu, &main_screen); // Exibe a interface do menu
 
     /* Estrutura para o temporizador */
     struct repeating_timer timer;
@@ -369,96 +639,375 @@ int main() {
     // Configura o temporizador para chamar a função de callback a cada segundo
     add_repeating_timer_ms(1000, repeating_timer_callback, NULL, &timer);
 
-    nota(DO, 250); // Toca a nota Sol por 250 ms
-    sleep_ms(250);
-    nota(FA, 250); // Toca a nota Lá por 250 ms
-    sleep_ms(250);
-    nota(SI, 250); // Toca a nota Si por 250 ms
-    sleep_ms(250);
+    audio_init(&audio, BUZZER_A, BUZZER_B); // Inicializa o áudio por DMA nos buzzers
+    audio_play_song(&audio, VOICE_MUSIC, intro_song, count_of(intro_song), 255, false); // Toca sem bloquear o menu
+
+    absolute_time_t next_frame = get_absolute_time();
 
     while (true) { // Loop principal do jogo
+        next_frame = delayed_by_ms(next_frame, FRAME_MS); // Período fixo, independente do tempo gasto no quadro
+
         PLAYER(); // Atualiza a lógica do jogador
 
-        if (screen == 0) {
-            menu_select(); // Seleciona a opção do menu
+        uint8_t event;
+        while (event_take(&event)) {
+            button_event(event); // Trata os botões pressionados desde o último quadro
         }
 
-        npUpdate(); // Atualiza a matriz de LEDs
-        sleep_ms(20); // Aguarda um curto período
+        if (state == STATE_MENU) {
+            menu_event_t input = joystick_event();
+            if (input != MENU_EVENT_NONE) {
+                menu_handle(&menu, input); // O menu só redesenha quando algo muda
+            }
+        } else {
+            game_render(); // Desenha o quadro do jogo no OLED
+            render_report();
+        }
+
+        usb_command();
+        if (mirroring) {
+            mirror_update(&mirror, ssd.ram_buffer, anim.out); // Só as páginas alteradas; LEDs como exibidos
+        }
+        frame_wait(next_frame); // Aguarda o próximo quadro
     }    
 }
 
 
-/* Função para exibir a interface do menu */
-void menu_interface() {
-    ssd1306_rect(&ssd, 3, 3, 122, 58, true, false);  // Desenha a borda fixa
-    ssd1306_draw_string(&ssd, "PLAY", 48, 24); // Desenha a opção "PLAY"
-    ssd1306_draw_string(&ssd, "SOBRE", 44, 34); // Desenha a opção "SOBRE"
-    ssd1306_rect(&ssd, 24, 32, 7, 7, true, true);  // Indica a opção selecionada
-    ssd1306_rect(&ssd, 34, 32, 7, 7, true, false); // Indica a opção não selecionada
-    ssd1306_send_data(&ssd); // Atualiza o display
-}
-
+/* Converte o joystick em eventos do menu, apenas ao sair da zona central */
+menu_event_t joystick_event() {
+    static menu_event_t held = MENU_EVENT_NONE; // Direção do quadro anterior
 
-/* Função para selecionar opções do menu */
-void menu_select() {
-    adc_select_input(1); // Lê o eixo X (ADC1)   
-    uint16_t x_value = adc_read(); // Lê o valor do eixo X
-    
     adc_select_input(0); // Lê o eixo Y (ADC0)
-    uint16_t y_value = adc_read(); // Lê o valor do eixo Y
-    if (y_value > 3000) {            
-        menu = 0; // Seleciona a opção "PLAY"
-        ssd1306_rect(&ssd, 24, 32, 7, 7, true, true); // Indica a opção "PLAY" como selecionada             
-        ssd1306_draw_char(&ssd, ' ', 32, 34); // Limpa a opção "SOBRE"
-        ssd1306_rect(&ssd, 34, 32, 7, 7, true, false); // Indica a opção "SOBRE" como não selecionada
+    uint16_t y_value = adc_read();
+    adc_select_input(1); // Lê o eixo X (ADC1)
+    uint16_t x_value = adc_read();
+
+    menu_event_t current = MENU_EVENT_NONE;
+    if (y_value > 3000) {
+        current = MENU_EVENT_UP;
     } else if (y_value < 1000) {
-        menu = 1; // Seleciona a opção "SOBRE"            
-        ssd1306_draw_char(&ssd, ' ', 32, 24); // Limpa a opção "PLAY"
-        ssd1306_rect(&ssd, 24, 32, 7, 7, true, false); // Indica a opção "PLAY" como não selecionada
-        ssd1306_rect(&ssd, 34, 32, 7, 7, true, true); // Indica a opção "SOBRE" como selecionada
+        current = MENU_EVENT_DOWN;
+    } else if (x_value < 1000) {
+        current = MENU_EVENT_LEFT;
+    } else if (x_value > 3000) {
+        current = MENU_EVENT_RIGHT;
     }
-    ssd1306_send_data(&ssd); // Atualiza o display
+
+    if (current == held) {
+        return MENU_EVENT_NONE; // Sem mudança: nada a redesenhar
+    }
+    held = current;
+    return current;
 }
 
 
-/* Função para exibir a pontuação */
-void score_display() {
-    char buffer[4]; // Buffer para armazenar a pontuação como string
+/* Função para iniciar uma partida */
+void game_start() {
+    score = 0;
+    vivo = true;
+    state = STATE_GAME;
+    game_interface();
+    anim_play(&anim, &fx_level, 0); // Transição de entrada na partida
+    audio_play_song(&audio, VOICE_MUSIC, game_song, count_of(game_song), 96, true); // Música de fundo
+}
+
+
+/* Transporte do enlace sobre a UART. A FIFO de 32 bytes da UART não aguenta
+   as rajadas de um tick (ecos e retransmissões), então a interrupção de
+   recepção a esvazia numa fila circular que o enlace lê a cada quadro. */
+static uint8_t link_rx_buffer[LINK_RX_BUFFER];
+static volatile uint16_t link_rx_head = 0; // Escrito só pela interrupção
+static volatile uint16_t link_rx_tail = 0; // Escrito só pelo laço principal
+static volatile uint32_t link_rx_overflows = 0;
+
+static void __not_in_flash_func(uart_link_irq)() {
+    while (uart_is_readable(LINK_UART)) {
+        uint8_t byte = uart_getc(LINK_UART);
+        uint16_t next = (link_rx_head + 1) & (LINK_RX_BUFFER - 1);
+        if (next == link_rx_tail) {
+            link_rx_overflows++; // Fila cheia: o byte se perde e o CRC descarta o quadro
+            continue;
+        }
+        link_rx_buffer[link_rx_head] = byte;
+        link_rx_head = next;
+    }
+}
+
+static void uart_link_write(void *ctx, const uint8_t *data, size_t len) {
+    uart_write_blocking(LINK_UART, data, len); // Cabe na FIFO de 32 bytes
+}
+
+static int uart_link_read(void *ctx) {
+    if (link_rx_tail == link_rx_head) {
+        return -1;
+    }
+    uint8_t byte = link_rx_buffer[link_rx_tail];
+    link_rx_tail = (link_rx_tail + 1) & (LINK_RX_BUFFER - 1);
+    return byte;
+}
+
+static uint32_t uart_link_now(void *ctx) {
+    return time_us_32();
+}
+
+
+/* Função para iniciar uma partida contra outra placa ligada pela UART */
+void versus_start() {
+    static const link_transport_t transport = {uart_link_write, uart_link_read, uart_link_now, NULL};
+
+    uart_init(LINK_UART, LINK_BAUD);
+    gpio_set_function(LINK_TX, GPIO_FUNC_UART);
+    gpio_set_function(LINK_RX, GPIO_FUNC_UART);
+    while (uart_is_readable(LINK_UART)) {
+        uart_getc(LINK_UART); // Descarta restos de uma partida anterior
+    }
+    link_rx_head = link_rx_tail = 0;
+    irq_set_exclusive_handler(UART0_IRQ, uart_link_irq);
+    irq_set_enabled(UART0_IRQ, true);
+    uart_set_irq_enables(LINK_UART, true, false); // RX: FIFO com dados ou tempo esgotado
+
+    // O nonce da apresentação mistura o ID único da placa com o instante da
+    // partida: as duas pontas não coincidem, e cada sessão tem um nonce novo,
+    // então o outro lado reconhece uma nova partida e encerra a anterior
+    pico_unique_board_id_t board;
+    pico_get_unique_board_id(&board);
+    uint32_t nonce = time_us_32();
+    for (uint8_t i = 0; i < PICO_UNIQUE_BOARD_ID_SIZE_BYTES; i++) {
+        nonce = (nonce << 8 | nonce >> 24) ^ board.id[i];
+    }
+
+    link_init(&link, &transport, LINK_DELAY, nonce);
+    versus_init(&duel);
+    fire_pending = false;
+    versus = true;
+    game_start();
+}
+
+
+/* Função para avançar um tick do modo versus: troca as entradas com a outra
+   placa e aplica as regras só quando as duas entradas do tick chegaram.
+   Retorna false se o outro lado saiu (ou sumiu) e a partida foi encerrada */
+bool versus_tick() {
+    static uint32_t last_report = 0;
+    uint8_t input = ((uint8_t)smoothed_value & LINK_INPUT_LANE) | (fire_pending ? LINK_INPUT_FIRE : 0);
+    uint16_t sent = link.local_seq;
+    uint8_t local, remote;
+
+    bool ready = link_update(&link, input, &local, &remote);
+    if (link.local_seq != sent) {
+        fire_pending = false; // A entrada com o disparo foi enviada
+    }
+    if (link.closed) {
+        printf("link: o outro lado saiu no tick %u\n", link.tick);
+        game_end();
+        return false;
+    }
+
+    if (ready) {
+        uint8_t me = link.player;  // Papel definido na apresentação: igual nas duas placas
+        uint8_t other = 1 - me;
+        uint16_t previous = duel.score[0] + duel.score[1];
+        if (me == 0) {
+            versus_step(&duel, local, remote);
+        } else {
+            versus_step(&duel, remote, local);
+        }
+
+        e_position = 6 - duel.lane[other]; // O adversário é visto espelhado
+        matrixSetEnemy(e_position, 80, 80, 0);
+
+        if (local & LINK_INPUT_FIRE) {
+            shot_player(local & LINK_INPUT_LANE, 80, 0, 80);
+            audio_play_sample(&audio, VOICE_SHOT, &snd_laser, 160);
+            if (shot_count < MAX_SHOTS) {
+                shots[shot_count].x = lane_to_x(local & LINK_INPUT_LANE);
+                shots[shot_count].y = SHIP_Y - 4;
+                shot_count++;
+            }
+        }
+        if (duel.hit[other]) {
+            anim_play(&anim, &fx_explosion, e_position - 3); // Efeitos centrados na posição 3
+            audio_play_sample(&audio, VOICE_BOOM, &snd_explosion, 255);
+            boom_frames = BOOM_FRAMES;
+        }
+        if (duel.hit[me]) {
+            anim_play(&anim, &fx_hit, duel.lane[me] - 3); // Fomos atingidos
+            audio_play_sample(&audio, VOICE_HIT, &snd_hit, 255);
+        }
+        if (duel.score[0] + duel.score[1] != previous) {
+            score = duel.score[me];
+            score_display();
+        }
+    }
+
+    // Latência e banda do enlace, uma vez por segundo pela USB
+    if (time_us_32() - last_report > 1000000) {
+        last_report = time_us_32();
+        printf("link: jogador %d tick %u rtt %lu us (max %lu) bytes/tick %u/%u crc %lu retx %lu paradas %lu rx cheia %lu checksum %08lx\n",
+               link.player, link.tick, (unsigned long)link.stats.rtt_us, (unsigned long)link.stats.rtt_max_us,
+               link.stats.tick_bytes_sent, link.stats.tick_bytes_received,
+               (unsigned long)link.stats.crc_errors, (unsigned long)link.stats.retransmits,
+               (unsigned long)link.stats.stalls, (unsigned long)link_rx_overflows,
+               (unsigned long)duel.checksum);
+    }
+    return true;
+}
+
+
+/* Função para aguardar o próximo quadro. No versus o enlace continua sendo
+   lido a cada LINK_POLL_US: a resposta a um quadro do outro lado sai na hora,
+   e a ida e volta fica abaixo de um quadro em vez de esperar o próximo tick */
+void frame_wait(absolute_time_t next_frame) {
+    if (!versus) {
+        sleep_until(next_frame);
+        return;
+    }
+    while (absolute_time_diff_us(get_absolute_time(), next_frame) > 0) {
+        link_poll(&link);
+        absolute_time_t wake = make_timeout_time_us(LINK_POLL_US);
+        sleep_until(absolute_time_diff_us(wake, next_frame) < 0 ? next_frame : wake);
+    }
+}
+
+
+/* Função para encerrar a partida, registrar o recorde e voltar ao menu */
+void game_end() {
+    if (versus) {
+        // Avisa o outro lado (que senão esperaria para sempre pelas nossas
+        // entradas) e para de receber pela UART
+        link_close(&link, LINK_LEAVE_US);
+        uart_set_irq_enables(LINK_UART, false, false);
+    }
+    state = STATE_MENU;
+    versus = false;
+    ssd1306_scroll_stop(&ssd);
+    matrixSetEnemy(0, 0, 0, 0); // Apaga o inimigo e os disparos da matriz
+    anim_stop(&anim);
+    anim_play(&anim, &fx_game_over, 0);
+    audio_play_song(&audio, VOICE_MUSIC, game_over_song, count_of(game_over_song), 255, false);
+
+    // Insere a pontuação na tabela de recordes, mantendo a ordem decrescente
+    uint16_t value = score;
+    for (uint8_t i = 0; i < count_of(high_scores); i++) {
+        if (value > high_scores[i]) {
+            uint16_t previous = high_scores[i];
+            high_scores[i] = value;
+            value = previous;
+        }
+    }
+
+    menu_open(&menu, &main_screen);
+}
+
+
+/* Função para disparar: desenha o tiro na matriz, cria o sprite e verifica o acerto */
+void game_fire() {
+    shot_player(smoothed_value, 80, 0, 80);
+    audio_play_sample(&audio, VOICE_SHOT, &snd_laser, 160);
+
+    if (shot_count < MAX_SHOTS) {
+        shots[shot_count].x = lane_to_x(smoothed_value);
+        shots[shot_count].y = SHIP_Y - 4;
+        shot_count++;
+    }
+
+    // Se atingir o enemy
+    if (smoothed_value == e_position || smoothed_value == e_position + 1 || smoothed_value == e_position - 1)
+    {
+        anim_play(&anim, &fx_explosion, e_position - 3); // Efeitos centrados na posição 3
+        audio_play_sample(&audio, VOICE_BOOM, &snd_explosion, 255);
+        score++;
+        boom_frames = BOOM_FRAMES;
+        score_display();
+    }
+}
+
 
-    sprintf(buffer, "%u", score); // Converte uint16_t para string
+/* Função para exibir a tela do jogo: placar fixo e campo de estrelas rolado pelo próprio SSD1306 */
+void game_interface() {
+    uint32_t seed = 0x1234567; // Semente fixa: o mesmo céu a cada partida
 
+    ssd1306_scroll_stop(&ssd); // Garante a GDDRAM parada antes de reescrever a tela
     ssd1306_fill(&ssd, false); // Limpa o display
-    ssd1306_rect(&ssd, 3, 3, 122, 58, true, false); // Desenha a borda fixa
-    ssd1306_draw_string(&ssd, "SCORE", 28, 28); // Desenha o texto "SCORE"
-    ssd1306_draw_string(&ssd, buffer, 76, 28); // Desenha a pontuação
-    ssd1306_send_data(&ssd); // Atualiza o display
+
+    // Espalha as estrelas na faixa logo abaixo do placar
+    for (uint8_t i = 0; i < STAR_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint8_t x = (seed >> 8) % DISPLAY_WIDTH;
+        uint8_t y = HUD_ROWS + (seed >> 20) % STAR_ROWS;
+        ssd1306_pixel(&ssd, x, y, true);
+    }
+
+    ssd1306_hline(&ssd, 0, DISPLAY_WIDTH - 1, HUD_ROWS - 2, true); // Separador do placar
+    ssd1306_send_data(&ssd); // Envia o quadro completo uma única vez
+    score_display(); // Desenha o placar
+
+    // A partir daqui o controlador anima o fundo sozinho: só a página 2 rola na
+    // horizontal e na vertical. Cada envio à GDDRAM (campo de jogo e placar)
+    // pausa a rolagem e a retoma em seguida; o campo só é enviado depois que a
+    // rolagem correu SSD1306_SCROLL_RUN_US (~3 quadros do display), então as
+    // estrelas andam e o campo é atualizado a ~25 Hz com a lógica a 50 FPS.
+    ssd1306_scroll_start(&ssd, HUD_ROWS, STAR_ROWS, HUD_ROWS / 8, HUD_ROWS / 8, SCROLL_2_FRAMES, 1);
+
+    shot_count = 0;
+    boom_frames = 0;
+    render_init(&field, &ssd, FIELD_FIRST_PAGE, FIELD_LAST_PAGE);
 }
 
-// Função para tocar uma frequência por uma duração específica
-void nota(uint32_t frequencia, uint32_t tempo_ms) {
-    configure_pwm(BUZZER_A); // Configura o PWM para o buzzer A
-    configure_pwm(BUZZER_B); // Configura o PWM para o buzzer B
 
-    uint32_t delay = 1000000 / (frequencia * 2);  // Calcula o tempo de atraso em microssegundos
-    uint32_t ciclo = frequencia * tempo_ms / 1000;  // Calcula o número de ciclos necessários
+/* Função para desenhar um quadro do jogo: nave, inimigo e disparos como sprites */
+void __not_in_flash_func(game_render)() {
+    int16_t player_x = lane_to_x(smoothed_value);
 
-    // Configura o PWM para a frequência desejada
-    pwm_set_gpio_level(BUZZER_A, 32768); // Define o nível de PWM (50% de duty cycle)
-    pwm_set_gpio_level(BUZZER_B, 32768); // Define o nível de PWM (50% de duty cycle)
+    if (versus && !versus_tick()) {
+        return; // O outro lado saiu: a partida acabou e o menu já está na tela
+    }
+
+    render_begin(&field);
 
-    // Loop para gerar a onda quadrada no buzzer
-    for (uint32_t i = 0; i < ciclo; i++) {
-        sleep_us(delay); // Espera pelo tempo de atraso calculado
+    if (boom_frames) {
+        boom_frames--;
+        render_sprite(&field, &boom_sprite, lane_to_x(e_position) - 4, ENEMY_Y);
+    } else {
+        render_sprite(&field, &enemy_sprite, lane_to_x(e_position) - 5, ENEMY_Y);
     }
 
-    pwm_set_gpio_level(BUZZER_A, 0); // Desliga o PWM
+    // Move os disparos para cima; os que saem do campo são descartados
+    for (uint8_t i = 0; i < shot_count;) {
+        shots[i].y -= SHOT_SPEED;
+        if (render_sprite(&field, &shot_sprite, shots[i].x, shots[i].y)) {
+            i++;
+        } else {
+            shots[i] = shots[--shot_count];
+        }
+    }
 
-    pwm_set_gpio_level(BUZZER_B, 0); // Desliga o PWM
+    render_sprite(&field, &ship_sprite, player_x - 5, SHIP_Y);
+    render_end(&field); // Envia só as colunas alteradas (nada se o quadro não mudou)
+}
+
+
+/* Função para exibir a pontuação */
+void score_display() {
+    char buffer[6]; // Buffer para armazenar a pontuação como string
+
+    ssd1306_rect(&ssd, 0, 0, DISPLAY_WIDTH, HUD_ROWS - 2, false, true); // Limpa só o placar
+    if (versus) {
+        char duel_buffer[14];
+        uint8_t me = link.player > 0 ? 1 : 0;
+        sprintf(duel_buffer, "%u X %u", duel.score[me], duel.score[1 - me]); // Nosso placar primeiro
+        ssd1306_draw_string(&ssd, "VS", 12, 3);
+        ssd1306_draw_string(&ssd, duel_buffer, 36, 3);
+    } else {
+        sprintf(buffer, "%u", score); // Converte uint16_t para string
+        ssd1306_draw_string(&ssd, "SCORE", 28, 3); // Desenha o texto "SCORE"
+        ssd1306_draw_string(&ssd, buffer, 76, 3); // Desenha a pontuação
+    }
+    ssd1306_send_pages(&ssd, 0, (HUD_ROWS / 8) - 1); // Atualiza apenas as páginas do placar
 }
 
 // Função do Joystick
-void PLAYER() 
+void __not_in_flash_func(PLAYER)()
 {    
     adc_select_input(1);
     uint16_t raw_value = adc_read();    
@@ -477,8 +1026,13 @@ void PLAYER()
 
 void ENEMY()
 {
-    // Gera um número aleatório entre 0 e 1
-    int direction = rand() % 2; // 0 para decrementar, 1 para incrementar
+    // Gera um número aleatório entre 0 e 1 (xorshift: rand() da newlib não é
+    // seguro dentro da interrupção do temporizador e pode alocar estado no heap)
+    static uint32_t seed = 0x2545F491;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    int direction = seed & 1; // 0 para decrementar, 1 para incrementar
 
     // Atualiza a posição com base na direção
     if (direction == 0) {
@@ -499,7 +1053,7 @@ void ENEMY()
 
 bool repeating_timer_callback(struct repeating_timer *t)
 {
-    if (vivo && play)
+    if (vivo && state == STATE_GAME && !versus) // No versus o inimigo é o outro jogador
     {
         ENEMY();
     }    
@@ -508,7 +1062,8 @@ bool repeating_timer_callback(struct repeating_timer *t)
     return true;
 }
 
-// Função de interrupção com debouncing do botão A
+// Função de interrupção com debouncing dos botões: apenas registra o evento,
+// as transições de tela e a lógica do jogo rodam no laço principal
 void gpio_irq_handler(uint gpio, uint32_t events)
 {
     // Obtém o tempo atual em microssegundos
@@ -517,50 +1072,13 @@ void gpio_irq_handler(uint gpio, uint32_t events)
     if (current_time - last_time > 500000) // 500 ms de debouncing
     {
         if (gpio == BUTTON_A)
-        {            
-            if (menu == 0 && play == false)
-            {
-                play = true;
-                screen = 2;
-                score_display();
-            }
-            else if (menu == 1 && !play)
-            {                
-                screen = 1;
-                ssd1306_fill(&ssd, false);
-                ssd1306_rect(&ssd, 3, 3, 122, 58, true, false);  // borda fixa                                                
-
-                ssd1306_draw_string(&ssd, "SPACE WAR", 24, 20);                
-
-                ssd1306_draw_string(&ssd, "THIAGOSOUSA81", 12, 30);            
-
-                ssd1306_draw_string(&ssd, "EMBARCATECH", 18, 40);
-                ssd1306_send_data(&ssd);                        
-            }
-            else if (screen == 1 && menu == 1) 
-            {
-                menu_interface();
-                screen = 0;                
-            }
+        {
+            event_post(EVENT_BUTTON_A);
             last_time = current_time; // Atualiza o tempo do último evento
         }
         else if (gpio == BUTTON_B)
         {
-            if (play == true)
-            {
-                //nota(LA, 250); // Toca a nota Lá por 250 ms 
-
-                shot_player(smoothed_value, 80, 0, 80);
-
-                // Se atingir o enemy 
-                if (smoothed_value == e_position || smoothed_value == e_position + 1 || smoothed_value == e_position - 1)
-                {
-                    matrixSetEnemy(e_position, 80, 80, 80);
-                    score++;
-                    score_display();
-
-                } 
-            }            
+            event_post(EVENT_BUTTON_B);
             last_time = current_time; // Atualiza o tempo do último evento
         }
     }
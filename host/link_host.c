@@ -0,0 +1,229 @@
+/*
+  Teste do enlace versus no Linux: duas instâncias conversam por um
+  pseudo-terminal usando o mesmo link.c e versus.c do firmware.
+
+  Terminal 1:  ./link_host --create --player 1
+               (imprime o caminho do pseudo-terminal, ex.: /dev/pts/5)
+  Terminal 2:  ./link_host /dev/pts/5 --player 2
+
+  --player só diferencia as entradas simuladas e o nonce de cada instância;
+  como no firmware, o papel (jogador 0 ou 1) sai da apresentação do enlace.
+
+  Opções: --delay N (atraso de entrada em ticks), --ticks N, --drop P
+  (descarta P% dos bytes enviados para exercitar o ressincronismo),
+  --seed S, --baud B (tempo de fio simulado; 0 desliga), --quit-at N (sai da
+  partida no tick N, como o botão A no firmware; a outra instância deve
+  encerrar também). Ao final as duas instâncias devem imprimir o mesmo
+  checksum.
+
+  Como no firmware, o enlace é lido a cada LINK_POLL_US entre os ticks e cada
+  byte ocupa 10 bits no fio (115200 por padrão, LINK_BAUD do firmware), então
+  a ida e volta medida aqui é comparável à das placas.
+*/
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "inc/link.h"
+#include "inc/versus.h"
+
+#define TICK_US 20000 // Mesmo período de quadro do firmware
+
+typedef struct {
+  int fd;
+  unsigned byte_us;             // Tempo de um byte no fio (8N1)
+  unsigned drop_percent;
+  uint32_t rng;
+  uint32_t dropped;
+} host_port_t;
+
+static uint32_t next_random(uint32_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+static uint32_t host_now_us(void *ctx) {
+  struct timespec ts;
+  (void)ctx;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+static void host_write(void *ctx, const uint8_t *data, size_t len) {
+  host_port_t *port = ctx;
+  if (port->byte_us)
+    usleep(port->byte_us * len); // O quadro só chega ao outro lado depois do tempo de fio
+  for (size_t i = 0; i < len; ++i) {
+    if (port->drop_percent && next_random(&port->rng) % 100 < port->drop_percent) {
+      port->dropped++;
+      continue;
+    }
+    while (write(port->fd, &data[i], 1) < 0 && errno == EAGAIN)
+      ;
+  }
+}
+
+static int host_read(void *ctx) {
+  host_port_t *port = ctx;
+  uint8_t byte;
+  return read(port->fd, &byte, 1) == 1 ? byte : -1;
+}
+
+static int open_port(const char *path, int create) {
+  int fd;
+  if (create) {
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd < 0 || grantpt(fd) < 0 || unlockpt(fd) < 0)
+      return -1;
+    printf("pty: %s\n", ptsname(fd));
+    fflush(stdout);
+  } else {
+    fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0)
+      return -1;
+  }
+
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  int create = 0;
+  unsigned player = 1, delay = 2, ticks = 500, drop = 0, seed = 1, baud = 115200, quit_at = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--create"))
+      create = 1;
+    else if (!strcmp(argv[i], "--player") && i + 1 < argc)
+      player = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--delay") && i + 1 < argc)
+      delay = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--ticks") && i + 1 < argc)
+      ticks = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--drop") && i + 1 < argc)
+      drop = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+      seed = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--baud") && i + 1 < argc)
+      baud = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--quit-at") && i + 1 < argc)
+      quit_at = atoi(argv[++i]);
+    else
+      path = argv[i];
+  }
+  if (!create && !path) {
+    fprintf(stderr, "uso: %s (--create | <pty>) [--player 1|2] [--delay N] [--ticks N] [--drop P] [--seed S] [--baud B] [--quit-at N]\n", argv[0]);
+    return 2;
+  }
+
+  host_port_t port = {0};
+  port.fd = open_port(path, create);
+  port.byte_us = baud ? 10000000u / baud : 0;
+  port.drop_percent = drop;
+  port.rng = 0x9E3779B9u * (seed + player);
+  if (port.fd < 0) {
+    perror("pty");
+    return 1;
+  }
+
+  link_transport_t io = {host_write, host_read, host_now_us, &port};
+  link_t link;
+  versus_t game;
+  link_init(&link, &io, delay, 0x9E3779B9u * player ^ (uint32_t)getpid());
+  versus_init(&game);
+
+  uint32_t input_rng = 0x12345u * (player + 7) + seed;
+  uint8_t lane = 3;
+  uint32_t rtt_total = 0, rtt_samples = 0, stalled = 0;
+  uint16_t max_tick_bytes = 0;
+  uint32_t next_tick = host_now_us(NULL);
+  int quit = 0;
+
+  while (link.tick < ticks && !link.closed) {
+    if (quit_at && link.tick >= quit_at) {
+      link_close(&link, 200000); // Mesma espera do game_end() do firmware
+      printf("saiu no tick %u\n", link.tick);
+      quit = 1;
+      break;
+    }
+
+    // Entrada simulada: passeio aleatório da posição e disparos ocasionais
+    uint32_t r = next_random(&input_rng);
+    if (r % 4 == 0 && lane > 1)
+      lane--;
+    else if (r % 4 == 1 && lane < 5)
+      lane++;
+    uint8_t input = lane | ((r >> 8) % 5 == 0 ? LINK_INPUT_FIRE : 0);
+
+    uint8_t local, remote;
+    if (link_update(&link, input, &local, &remote)) {
+      if (link.player == 0) // O jogador 0 vem primeiro nas duas pontas
+        versus_step(&game, local, remote);
+      else
+        versus_step(&game, remote, local);
+
+      if (link.tick == 1)
+        link.stats.rtt_max_us = 0; // Descarta a espera pela outra instância na partida
+      rtt_total += link.stats.rtt_us;
+      rtt_samples++;
+      if (link.stats.tick_bytes_sent > max_tick_bytes)
+        max_tick_bytes = link.stats.tick_bytes_sent;
+      if (link.tick % 100 == 0)
+        printf("tick %u checksum %08x placar %u x %u rtt %u us\n", link.tick, game.checksum,
+               game.score[0], game.score[1], link.stats.rtt_us);
+    } else {
+      stalled++;
+    }
+
+    // Período fixo; enquanto espera, lê o enlace no mesmo ritmo do frame_wait() do firmware
+    next_tick += TICK_US;
+    while ((int32_t)(next_tick - host_now_us(NULL)) > 0) {
+      link_poll(&link);
+      int32_t left = (int32_t)(next_tick - host_now_us(NULL));
+      if (left > 0)
+        usleep(left < LINK_POLL_US ? left : LINK_POLL_US);
+    }
+  }
+
+  if (link.closed && !quit)
+    printf("o outro lado saiu no tick %u\n", link.tick);
+
+  // Mantém o enlace vivo até o outro lado confirmar todas as nossas entradas
+  // e responder às retransmissões dele por mais um tempo (ou até 5 s)
+  uint32_t start = host_now_us(NULL), acked_at = 0;
+  while (!link.closed && host_now_us(NULL) - start < 5000000) {
+    if (link_flush(&link) && !acked_at)
+      acked_at = host_now_us(NULL);
+    if (acked_at && host_now_us(NULL) - acked_at > 500000)
+      break;
+    usleep(1000);
+  }
+
+  printf("fim: jogador %d ticks %u checksum %08x placar %u x %u\n", link.player, link.tick, game.checksum,
+         game.score[0], game.score[1]);
+  printf("rtt medio %u us, max %u us (tick %u us)\n", rtt_samples ? rtt_total / rtt_samples : 0,
+         link.stats.rtt_max_us, TICK_US);
+  printf("bytes/tick max %u enviados; total %u enviados, %u recebidos\n", max_tick_bytes,
+         link.stats.bytes_sent, link.stats.bytes_received);
+  printf("quadros %u/%u, crc %u, bytes descartados %u, retransmissoes %u, ticks parados %u, bytes perdidos %u\n",
+         link.stats.frames_sent, link.stats.frames_received, link.stats.crc_errors, link.stats.skipped_bytes,
+         link.stats.retransmits, stalled, port.dropped);
+  close(port.fd);
+  return 0;
+}
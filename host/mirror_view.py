@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+Visualizador do espelho do SpaceWar: reconstrói o OLED e a matriz de LEDs a
+partir dos pacotes enviados pela USB (inc/mirror.c) e desenha no terminal.
+
+  python3 host/mirror_view.py /dev/ttyACM0
+
+Envia 'M' ao abrir (liga o espelho e pede um quadro-chave) e 'm' ao sair.
+Usa só a biblioteca padrão. Texto fora dos pacotes (ex.: estatísticas do
+enlace versus) aparece na última linha.
+
+Observação: a faixa de estrelas usa a rolagem por hardware do SSD1306, que
+não altera o framebuffer; no espelho ela aparece parada.
+"""
+
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+SYNC = 0xC3
+PAGES = 8
+WIDTH = 128
+LED_BYTES = 75
+CHANNEL_LEDS = PAGES
+RAW = 0x80
+HEADER_SIZE = 4
+
+
+def crc16(data):
+    """CRC-16/CCITT, igual a link_crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def unpackbits(data, length):
+    out = bytearray()
+    i = 0
+    while i < len(data) and len(out) < length:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    if len(out) != length:
+        raise ValueError("PackBits com tamanho inválido")
+    return out
+
+
+class Mirror:
+    """Cópia local dos canais, atualizada pacote a pacote."""
+
+    def __init__(self):
+        self.channels = [bytearray(WIDTH) for _ in range(PAGES)] + [bytearray(LED_BYTES)]
+        self.seq = [None] * (PAGES + 1)   # None: esperando quadro-chave
+        self.buffer = bytearray()
+        self.text = bytearray()
+        self.packets = self.bytes = self.crc_errors = self.lost = 0
+
+    def feed(self, data):
+        """Processa bytes recebidos; retorna True se algum canal mudou."""
+        self.buffer += data
+        changed = False
+        while self.buffer:
+            if self.buffer[0] != SYNC:
+                self.text.append(self.buffer.pop(0))
+                continue
+            if len(self.buffer) < HEADER_SIZE:
+                break
+            size = HEADER_SIZE + self.buffer[3] + 2
+            if len(self.buffer) < size:
+                break
+            packet = bytes(self.buffer[:size])
+            if crc16(packet[1:size - 2]) != (packet[-2] << 8 | packet[-1]):
+                self.crc_errors += 1
+                self.text.append(self.buffer.pop(0))  # Ressincroniza no próximo 0xC3
+                continue
+            del self.buffer[:size]
+            changed |= self.apply(packet)
+        return changed
+
+    def apply(self, packet):
+        channel = packet[1] & 0x0F
+        raw = packet[1] & RAW
+        seq = packet[2]
+        if channel > CHANNEL_LEDS:
+            return False
+        length = LED_BYTES if channel == CHANNEL_LEDS else WIDTH
+        data = unpackbits(packet[HEADER_SIZE:-2], length)
+
+        self.packets += 1
+        self.bytes += len(packet)
+        expected = self.seq[channel]
+        if raw:
+            self.channels[channel][:] = data
+        elif expected is not None and seq == expected:
+            for i, d in enumerate(data):
+                self.channels[channel][i] ^= d
+        else:
+            if expected is not None:
+                self.lost += 1
+            self.seq[channel] = None  # XOR sobre base desconhecida: espera o quadro-chave
+            return False
+        self.seq[channel] = (seq + 1) & 0xFF
+        return True
+
+    def pixel(self, x, y):
+        return (self.channels[y // 8][x] >> (y % 8)) & 1
+
+    def led(self, row, col):
+        """Cor (r, g, b) do LED na linha/coluna vista de frente (linha 0 no topo)."""
+        r = 4 - row
+        index = r * 5 + (4 - col if r % 2 == 0 else col)
+        g, red, b = self.channels[CHANNEL_LEDS][index * 3:index * 3 + 3]
+        return red, g, b
+
+
+def draw(mirror, out):
+    lines = ["\x1b[H"]
+    half = {(0, 0): " ", (1, 0): "▀", (0, 1): "▄", (1, 1): "█"}
+    for y in range(0, PAGES * 8, 2):
+        row = "".join(half[(mirror.pixel(x, y), mirror.pixel(x, y + 1))] for x in range(WIDTH))
+        leds = ""
+        if y // 2 < 5:
+            for col in range(5):
+                r, g, b = mirror.led(y // 2, col)
+                leds += "\x1b[48;2;%d;%d;%dm  \x1b[0m" % (min(255, r * 3), min(255, g * 3), min(255, b * 3))
+        lines.append("|" + row + "| " + leds + "\x1b[K\r\n")
+    text = mirror.text.decode("utf-8", "replace").strip().splitlines()
+    lines.append("pacotes %d  bytes %d  crc %d  perdidos %d\x1b[K\r\n"
+                 % (mirror.packets, mirror.bytes, mirror.crc_errors, mirror.lost))
+    lines.append((text[-1] if text else "") + "\x1b[K")
+    if len(mirror.text) > 4096:
+        del mirror.text[:-512]
+    out.write("".join(lines))
+    out.flush()
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("uso: %s <porta serial>" % sys.argv[0], file=sys.stderr)
+        return 2
+
+    fd = os.open(sys.argv[1], os.O_RDWR | os.O_NOCTTY)
+    saved = termios.tcgetattr(fd)
+    tty.setraw(fd)
+    os.write(fd, b"M")
+
+    mirror = Mirror()
+    sys.stdout.write("\x1b[2J\x1b[?25l")
+    last_draw = 0.0
+    dirty = True
+    try:
+        while True:
+            ready, _, _ = select.select([fd], [], [], 0.1)
+            if ready:
+                data = os.read(fd, 4096)
+                if not data:
+                    break
+                text = len(mirror.text)
+                dirty |= mirror.feed(data) or len(mirror.text) != text
+            now = time.monotonic()
+            if dirty and now - last_draw >= 0.02:  # Até 50 quadros por segundo, como o jogo
+                draw(mirror, sys.stdout)
+                last_draw = now
+                dirty = False
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.write(fd, b"m")
+        termios.tcsetattr(fd, termios.TCSANOW, saved)
+        os.close(fd)
+        sys.stdout.write("\x1b[?25h\r\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+Converte arquivos WAV em amostras C para o motor de áudio (inc/audio.c).
+
+  python3 host/wav2c.py -o inc/sounds host/sounds/laser.wav:pcm8 \\
+      host/sounds/explosion.wav:adpcm host/sounds/hit.wav:adpcm
+
+Gera <saida>.h e <saida>.c com um audio_sample_t por arquivo, nomeado
+snd_<nome do arquivo>. O áudio é misturado para mono, reamostrado para
+AUDIO_RATE com interpolação linear e codificado em PCM de 8 bits com sinal
+(pcm8) ou IMA ADPCM de 4 bits (adpcm, nibble baixo primeiro, estado inicial
+zerado, igual ao decodificador do firmware). Usa só a biblioteca padrão.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+AUDIO_RATE = 16000
+
+ADPCM_STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+ADPCM_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def read_wav(path):
+    """Lê o WAV como lista de amostras mono de 16 bits e a taxa original."""
+    with wave.open(path, "rb") as w:
+        channels, width, rate = w.getnchannels(), w.getsampwidth(), w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        values = [b - 128 << 8 for b in raw]
+    elif width == 2:
+        values = list(struct.unpack("<%dh" % (len(raw) // 2), raw))
+    else:
+        raise ValueError("%s: só WAV de 8 ou 16 bits" % path)
+    mono = [sum(values[i:i + channels]) // channels for i in range(0, len(values), channels)]
+    return mono, rate
+
+
+def resample(samples, rate):
+    if rate == AUDIO_RATE or not samples:
+        return samples
+    count = len(samples) * AUDIO_RATE // rate
+    out = []
+    for n in range(count):
+        pos = n * rate / AUDIO_RATE
+        i = int(pos)
+        frac = pos - i
+        a = samples[i]
+        b = samples[min(i + 1, len(samples) - 1)]
+        out.append(int(a + (b - a) * frac))
+    return out
+
+
+def encode_pcm8(samples):
+    return bytes((max(-128, min(127, s >> 8)) & 0xFF) for s in samples)
+
+
+def encode_adpcm(samples):
+    """IMA ADPCM escolhendo cada nibble pelo mesmo cálculo do decodificador."""
+    predictor, index = 0, 0
+    nibbles = []
+    for s in samples:
+        step = ADPCM_STEPS[index]
+        diff = s - predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+        if diff >= step >> 1:
+            nibble |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            nibble |= 1
+
+        # Reconstrói como o firmware, para o estado não divergir
+        delta = step >> 3
+        if nibble & 4:
+            delta += step
+        if nibble & 2:
+            delta += step >> 1
+        if nibble & 1:
+            delta += step >> 2
+        predictor += -delta if nibble & 8 else delta
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + ADPCM_INDEX[nibble & 7]))
+        nibbles.append(nibble)
+
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[i] | nibbles[i + 1] << 4 for i in range(0, len(nibbles), 2))
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converte WAV em amostras C para inc/audio.c")
+    parser.add_argument("-o", "--output", required=True, help="prefixo de saída (gera .h e .c)")
+    parser.add_argument("inputs", nargs="+", help="arquivo.wav:pcm8 ou arquivo.wav:adpcm")
+    args = parser.parse_args()
+
+    base = os.path.basename(args.output)
+    guard = base.upper() + "_H"
+    header = ["// Gerado por host/wav2c.py - não editar", "#ifndef " + guard, "#define " + guard, "",
+              '#include "audio.h"', ""]
+    source = ["// Gerado por host/wav2c.py - não editar", '#include "%s.h"' % base, ""]
+
+    for item in args.inputs:
+        path, _, fmt = item.rpartition(":")
+        if fmt not in ("pcm8", "adpcm"):
+            print("formato inválido em %s (use pcm8 ou adpcm)" % item, file=sys.stderr)
+            return 2
+        name = "snd_" + os.path.splitext(os.path.basename(path))[0]
+        samples, rate = read_wav(path)
+        samples = resample(samples, rate)
+        data = encode_pcm8(samples) if fmt == "pcm8" else encode_adpcm(samples)
+        kind = "AUDIO_PCM8" if fmt == "pcm8" else "AUDIO_ADPCM4"
+
+        header.append("extern const audio_sample_t %s; // %s, %d amostras, %d bytes"
+                      % (name, fmt, len(samples), len(data)))
+        source += ["static const uint8_t %s_data[] = {" % name, c_array(data), "};", "",
+                   "const audio_sample_t %s = {%s, %d, %s_data};" % (name, kind, len(samples), name), ""]
+
+    header += ["", "#endif", ""]
+    with open(args.output + ".h", "w") as f:
+        f.write("\n".join(header))
+    with open(args.output + ".c", "w") as f:
+        f.write("\n".join(source))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,135 @@
+#include <string.h>
+#include "anim.h"
+#include "hardware/dma.h"
+
+// Posição de cada LED (ordem visual) na cadeia da matriz:
+//   24, 23, 22, 21, 20
+//   15, 16, 17, 18, 19
+//   14, 13, 12, 11, 10
+//   05, 06, 07, 08, 09
+//   04, 03, 02, 01, 00
+static const uint8_t anim_wire[ANIM_LEDS] = {
+  24, 23, 22, 21, 20,
+  15, 16, 17, 18, 19,
+  14, 13, 12, 11, 10,
+   5,  6,  7,  8,  9,
+   4,  3,  2,  1,  0,
+};
+
+static inline uint8_t anim_lerp(uint8_t a, uint8_t b, uint16_t w) {
+  return a + (((int16_t)b - a) * w >> 8);
+}
+
+// Aplica um efeito sobre 'out'. Retorna false quando o efeito terminou.
+static bool __not_in_flash_func(anim_apply)(anim_t *anim, const anim_slot_t *slot, const anim_effect_t *effect, uint32_t now) {
+  uint32_t position = (now - slot->start_us) / 1000 * 256 / effect->frame_ms;
+  uint32_t k = position >> 8;
+  if (k + 1 >= effect->count)
+    return false;
+
+  const uint8_t *a = effect->frames[k];
+  const uint8_t *b = effect->frames[k + 1];
+  uint16_t w = position & 0xFF;
+  uint16_t scale = anim->scale + 1;
+
+  for (uint8_t row = 0; row < ANIM_SIDE; ++row) {
+    for (uint8_t col = 0; col < ANIM_SIDE; ++col) {
+      int8_t x = col + slot->shift;
+      if (x < 0 || x >= ANIM_SIDE)
+        continue;
+      uint8_t p = (row * ANIM_SIDE + col) * 3;
+      uint8_t *o = &anim->out[anim_wire[row * ANIM_SIDE + x] * 3];
+
+      uint8_t v[3];
+      for (uint8_t c = 0; c < 3; ++c)
+        v[c] = anim_lerp(a[p + c], b[p + c], w) * scale >> 8;
+
+      if (effect->blend == ANIM_BLEND_ADD) {
+        for (uint8_t c = 0; c < 3; ++c)
+          o[c] = o[c] + v[c] > 255 ? 255 : o[c] + v[c];
+      } else if (v[0] | v[1] | v[2]) {
+        for (uint8_t c = 0; c < 3; ++c)
+          o[c] = anim_lerp(o[c], v[c], effect->alpha);
+      }
+    }
+  }
+  return true;
+}
+
+// Temporizador: compõe camada do jogo + efeitos e dispara o DMA para o PIO.
+// Com 8 bits por transferência o byte é replicado na palavra da FIFO, então o
+// PIO (deslocamento à esquerda, autopull de 8 bits) envia os bits 31..24, o
+// próprio byte, do mais significativo para o menos, como o WS2812 espera.
+static bool __not_in_flash_func(anim_tick)(struct repeating_timer *t) {
+  anim_t *anim = t->user_data;
+  if (dma_channel_is_busy(anim->dma)) {
+    anim->skipped++;
+    return true;
+  }
+
+  uint32_t now = time_us_32();
+  uint16_t scale = anim->scale + 1;
+  for (uint8_t i = 0; i < ANIM_FRAME_BYTES; ++i)
+    anim->out[i] = anim->live[i] * scale >> 8;
+
+  for (uint8_t s = 0; s < ANIM_SLOTS; ++s) {
+    anim_slot_t *slot = &anim->slots[s];
+    const anim_effect_t *effect = slot->effect;
+    if (effect && !anim_apply(anim, slot, effect, now))
+      slot->effect = NULL;
+  }
+
+  dma_channel_transfer_from_buffer_now(anim->dma, anim->out, ANIM_FRAME_BYTES);
+
+  anim->compose_us = time_us_32() - now;
+  if (anim->compose_us > anim->compose_us_max)
+    anim->compose_us_max = anim->compose_us;
+  return true;
+}
+
+void anim_init(anim_t *anim, PIO pio, uint sm, const uint8_t *live, uint8_t scale) {
+  memset(anim, 0, sizeof(*anim));
+  anim->pio = pio;
+  anim->sm = sm;
+  anim->live = live;
+  anim->scale = scale;
+
+  anim->dma = dma_claim_unused_channel(true);
+  dma_channel_config config = dma_channel_get_default_config(anim->dma);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, pio_get_dreq(pio, sm, true));
+  dma_channel_configure(anim->dma, &config, &pio->txf[sm], anim->out, ANIM_FRAME_BYTES, false);
+
+  // Período negativo: conta a partir do início do callback anterior, sem deriva
+  add_repeating_timer_ms(-ANIM_PERIOD_MS, anim_tick, anim, &anim->timer);
+}
+
+// Inicia um efeito deslocado 'shift' colunas. Sem posição livre, substitui o
+// efeito mais antigo. Retorna a posição usada.
+int anim_play(anim_t *anim, const anim_effect_t *effect, int8_t shift) {
+  uint8_t chosen = 0;
+  for (uint8_t s = 0; s < ANIM_SLOTS; ++s) {
+    if (!anim->slots[s].effect) {
+      chosen = s;
+      break;
+    }
+    if ((int32_t)(anim->slots[s].start_us - anim->slots[chosen].start_us) < 0)
+      chosen = s;
+  }
+
+  anim_slot_t *slot = &anim->slots[chosen];
+  slot->effect = NULL; // O temporizador ignora a posição enquanto ela é preenchida
+  __compiler_memory_barrier();
+  slot->start_us = time_us_32();
+  slot->shift = shift;
+  __compiler_memory_barrier();
+  slot->effect = effect;
+  return chosen;
+}
+
+void anim_stop(anim_t *anim) {
+  for (uint8_t s = 0; s < ANIM_SLOTS; ++s)
+    anim->slots[s].effect = NULL;
+}
@@ -0,0 +1,60 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/pio.h"
+#include "pico/time.h"
+
+// Motor de animação da matriz WS2812: um temporizador compõe a camada do jogo
+// com até ANIM_SLOTS efeitos e envia o quadro ao PIO por DMA, sem ocupar o
+// laço principal. Os efeitos são sequências de quadros-chave constantes (na
+// flash), interpoladas com aritmética inteira.
+
+#define ANIM_LEDS 25
+#define ANIM_SIDE 5
+#define ANIM_FRAME_BYTES (ANIM_LEDS * 3)
+#define ANIM_SLOTS 4
+#define ANIM_PERIOD_MS 20              // 50 quadros por segundo
+
+typedef enum {
+  ANIM_BLEND_ADD,                      // Soma com saturação (brilhos, explosões)
+  ANIM_BLEND_ALPHA                     // Cobre a camada do jogo com opacidade 'alpha'; preto é transparente
+} anim_blend_t;
+
+// Quadro-chave: 25 LEDs GRB em ordem visual (linha 0 no topo, coluna 0 à
+// esquerda), independente do zigue-zague da matriz
+typedef uint8_t anim_frame_t[ANIM_FRAME_BYTES];
+
+typedef struct {
+  const anim_frame_t *frames;
+  uint8_t count;                       // Quadros-chave (o último encerra o efeito)
+  uint16_t frame_ms;                   // Tempo entre quadros-chave
+  uint8_t blend;
+  uint8_t alpha;
+} anim_effect_t;
+
+typedef struct {
+  const anim_effect_t *volatile effect; // NULL = livre
+  uint32_t start_us;
+  int8_t shift;                        // Deslocamento em colunas
+} anim_slot_t;
+
+typedef struct {
+  PIO pio;
+  uint sm;
+  int dma;
+  const uint8_t *live;                 // Camada do jogo (GRB na ordem da matriz)
+  volatile uint8_t scale;              // Brilho aplicado a tudo (0 a 255)
+  uint8_t out[ANIM_FRAME_BYTES];       // Quadro composto, origem do DMA
+  anim_slot_t slots[ANIM_SLOTS];
+  struct repeating_timer timer;
+  uint32_t compose_us, compose_us_max; // Tempo gasto na composição
+  uint32_t skipped;                    // Quadros pulados com o DMA ainda ocupado
+} anim_t;
+
+void anim_init(anim_t *anim, PIO pio, uint sm, const uint8_t *live, uint8_t scale);
+int anim_play(anim_t *anim, const anim_effect_t *effect, int8_t shift);
+void anim_stop(anim_t *anim);
+
+#endif
@@ -0,0 +1,218 @@
+#include <string.h>
+#include "audio.h"
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+
+#define AUDIO_SILENCE 128              // Meio da escala do PWM (wrap 255): repouso com vozes ativas
+
+static audio_t *audio_active;          // Instância atendida pela interrupção do DMA
+
+// Tabelas do IMA ADPCM na SRAM: lidas a cada amostra dentro da interrupção
+static const int16_t __not_in_flash("audio") adpcm_steps[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+  253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+  3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+  11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+  32767
+};
+
+static const int8_t __not_in_flash("audio") adpcm_index[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static inline int16_t __not_in_flash_func(adpcm_decode)(audio_voice_t *voice, uint8_t nibble) {
+  int16_t step = adpcm_steps[voice->index];
+  int32_t diff = step >> 3;
+  if (nibble & 4) diff += step;
+  if (nibble & 2) diff += step >> 1;
+  if (nibble & 1) diff += step >> 2;
+
+  int32_t predictor = voice->predictor + ((nibble & 8) ? -diff : diff);
+  if (predictor > 32767) predictor = 32767;
+  if (predictor < -32768) predictor = -32768;
+  voice->predictor = predictor;
+
+  int8_t index = voice->index + adpcm_index[nibble & 7];
+  voice->index = index < 0 ? 0 : index > 88 ? 88 : index;
+  return voice->predictor;
+}
+
+// Próxima amostra (16 bits com sinal) de uma voz; desliga a voz ao terminar.
+// Roda a cada amostra na interrupção: fica na SRAM mesmo se não for expandida.
+static inline int16_t __not_in_flash_func(audio_voice_next)(audio_voice_t *voice) {
+  if (voice->kind == AUDIO_VOICE_SAMPLE) {
+    const audio_sample_t *sample = voice->sample;
+    if (voice->position >= sample->length) {
+      voice->kind = AUDIO_VOICE_IDLE;
+      return 0;
+    }
+    uint32_t i = voice->position++;
+    if (sample->format == AUDIO_PCM8)
+      return (int8_t)sample->data[i] << 8;
+    uint8_t byte = sample->data[i >> 1];
+    return adpcm_decode(voice, (i & 1) ? byte >> 4 : byte & 0x0F);
+  }
+
+  // Música: onda quadrada por acumulador de fase
+  while (voice->remaining == 0) {
+    if (voice->position >= voice->count) {
+      if (!voice->loop) {
+        voice->kind = AUDIO_VOICE_IDLE;
+        return 0;
+      }
+      voice->position = 0;
+    }
+    const audio_note_t *note = &voice->notes[voice->position++];
+    voice->remaining = (uint32_t)note->ms * AUDIO_RATE / 1000;
+    voice->step = (uint32_t)(((uint64_t)note->freq << 32) / AUDIO_RATE);
+    voice->phase = 0;
+  }
+  voice->remaining--;
+  if (!voice->step)
+    return 0;
+  voice->phase += voice->step;
+  return (voice->phase & 0x80000000u) ? 8191 : -8192; // 1/4 da escala: deixa folga para os efeitos
+}
+
+// Mistura as vozes em ponto fixo: soma (amostra * volume) e satura na escala do PWM.
+// O nível de repouso sobe até AUDIO_SILENCE enquanto há voz ativa e desce a 0
+// (buzzer sem corrente) quando todas terminam, um passo por amostra (8 ms), sem estalo.
+static void __not_in_flash_func(audio_mix)(audio_t *audio, uint16_t *out) {
+  uint32_t start = time_us_32();
+  bool active = false;
+  for (uint8_t v = 0; v < AUDIO_VOICES; ++v)
+    active |= audio->voices[v].kind != AUDIO_VOICE_IDLE;
+  uint8_t target = active ? AUDIO_SILENCE : 0;
+
+  for (uint16_t n = 0; n < AUDIO_BUFFER; ++n) {
+    if (audio->bias < target)
+      audio->bias++;
+    else if (audio->bias > target)
+      audio->bias--;
+
+    int32_t acc = 0;
+    for (uint8_t v = 0; v < AUDIO_VOICES; ++v) {
+      audio_voice_t *voice = &audio->voices[v];
+      if (voice->kind != AUDIO_VOICE_IDLE)
+        acc += audio_voice_next(voice) * voice->volume;
+    }
+    acc >>= 16; // 16 bits da amostra + 8 do volume -> 8 bits
+    if (acc > 127) acc = 127;
+    if (acc < -128) acc = -128;
+    acc += audio->bias;
+    out[n] = acc < 0 ? 0 : acc;
+  }
+  audio->mix_us = time_us_32() - start;
+  if (audio->mix_us > audio->mix_us_max)
+    audio->mix_us_max = audio->mix_us;
+}
+
+// Fim de um buffer em um dos buzzers. O canal já encadeou o outro buffer;
+// aqui ele é rearmado e, quando os dois buzzers terminaram, o buffer é
+// misturado de novo (há um buffer inteiro de folga até ser lido).
+static void __not_in_flash_func(audio_dma_irq)() {
+  audio_t *audio = audio_active;
+  for (uint8_t lane = 0; lane < AUDIO_LANES; ++lane) {
+    for (uint8_t b = 0; b < 2; ++b) {
+      uint channel = audio->dma[lane][b];
+      if (!dma_irqn_get_channel_status(1, channel))
+        continue;
+      dma_irqn_acknowledge_channel(1, channel);
+      dma_channel_set_read_addr(channel, audio->buffer[b], false);
+
+      if (audio->done[b ^ 1] & (1u << lane))
+        audio->underruns++; // O outro buffer foi tocado sem ter sido misturado
+      audio->done[b] |= 1u << lane;
+      if (audio->done[b] == (1u << AUDIO_LANES) - 1) {
+        audio->done[b] = 0;
+        audio_mix(audio, audio->buffer[b]);
+      }
+    }
+  }
+}
+
+void audio_init(audio_t *audio, uint pin_a, uint pin_b) {
+  const uint pins[AUDIO_LANES] = {pin_a, pin_b};
+
+  memset(audio, 0, sizeof(*audio)); // Buffers e nível de repouso em 0: buzzers desligados
+  audio_active = audio;
+
+  // Portadora de clk_sys / 256 (~488 kHz), bem acima da faixa audível
+  for (uint8_t lane = 0; lane < AUDIO_LANES; ++lane) {
+    gpio_set_function(pins[lane], GPIO_FUNC_PWM);
+    audio->slice[lane] = pwm_gpio_to_slice_num(pins[lane]);
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv(&config, 1.0f);
+    pwm_config_set_wrap(&config, 255);
+    pwm_init(audio->slice[lane], &config, true);
+    pwm_set_gpio_level(pins[lane], 0);
+  }
+
+  // Temporizador do DMA: clk_sys * 2 / Y = AUDIO_RATE (Y = 15625 a 125 MHz)
+  int timer = dma_claim_unused_timer(true);
+  dma_timer_set_fraction(timer, 2, clock_get_hz(clk_sys) * 2 / AUDIO_RATE);
+
+  for (uint8_t lane = 0; lane < AUDIO_LANES; ++lane)
+    for (uint8_t b = 0; b < 2; ++b)
+      audio->dma[lane][b] = dma_claim_unused_channel(true);
+
+  // Escritas de 16 bits no registrador CC são replicadas nas duas metades
+  // (canais A e B do slice), então o mesmo buffer serve aos dois buzzers
+  for (uint8_t lane = 0; lane < AUDIO_LANES; ++lane) {
+    for (uint8_t b = 0; b < 2; ++b) {
+      uint channel = audio->dma[lane][b];
+      dma_channel_config config = dma_channel_get_default_config(channel);
+      channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+      channel_config_set_read_increment(&config, true);
+      channel_config_set_write_increment(&config, false);
+      channel_config_set_dreq(&config, dma_get_timer_dreq(timer));
+      channel_config_set_chain_to(&config, audio->dma[lane][b ^ 1]);
+      dma_channel_configure(channel, &config, &pwm_hw->slice[audio->slice[lane]].cc,
+                            audio->buffer[b], AUDIO_BUFFER, false);
+      dma_irqn_set_channel_enabled(1, channel, true);
+    }
+  }
+
+  irq_set_exclusive_handler(DMA_IRQ_1, audio_dma_irq);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  // Os dois buzzers partem juntos, com o mesmo ritmo do temporizador
+  dma_start_channel_mask((1u << audio->dma[0][0]) | (1u << audio->dma[1][0]));
+}
+
+// Prepara uma voz fora da interrupção: 'kind' é zerado antes e escrito por último
+static audio_voice_t *audio_voice_claim(audio_t *audio, uint8_t voice, uint8_t volume) {
+  audio_voice_t *v = &audio->voices[voice];
+  v->kind = AUDIO_VOICE_IDLE;
+  __compiler_memory_barrier();
+  v->volume = volume;
+  v->position = 0;
+  return v;
+}
+
+void audio_play_sample(audio_t *audio, uint8_t voice, const audio_sample_t *sample, uint8_t volume) {
+  audio_voice_t *v = audio_voice_claim(audio, voice, volume);
+  v->sample = sample;
+  v->predictor = 0;
+  v->index = 0;
+  __compiler_memory_barrier();
+  v->kind = AUDIO_VOICE_SAMPLE;
+}
+
+void audio_play_song(audio_t *audio, uint8_t voice, const audio_note_t *notes, uint16_t count, uint8_t volume, bool loop) {
+  audio_voice_t *v = audio_voice_claim(audio, voice, volume);
+  v->notes = notes;
+  v->count = count;
+  v->loop = loop;
+  v->remaining = 0;
+  v->step = 0;
+  __compiler_memory_barrier();
+  v->kind = AUDIO_VOICE_SONG;
+}
+
+void audio_stop(audio_t *audio, uint8_t voice) {
+  audio->voices[voice].kind = AUDIO_VOICE_IDLE;
+}
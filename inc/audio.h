@@ -0,0 +1,75 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/types.h"
+
+// Reprodução de áudio nos buzzers: PWM com portadora fixa (wrap 255) cujo
+// duty cycle é atualizado por DMA a AUDIO_RATE amostras por segundo, a partir
+// de dois buffers alternados. Ao terminar cada buffer, a interrupção do DMA
+// mistura as vozes ativas no buffer livre, com tempo limitado por buffer.
+// Sem vozes ativas o duty cycle vai a 0 e os buzzers ficam sem corrente.
+
+#define AUDIO_RATE 16000               // Amostras por segundo
+#define AUDIO_BUFFER 256               // Amostras por buffer (16 ms)
+#define AUDIO_VOICES 4
+#define AUDIO_LANES 2                  // Um fluxo de DMA por buzzer
+
+typedef enum {
+  AUDIO_PCM8,                          // 8 bits com sinal por amostra
+  AUDIO_ADPCM4                         // IMA ADPCM, 4 bits por amostra (nibble baixo primeiro)
+} audio_format_t;
+
+// Amostra na flash, já em AUDIO_RATE (gerada por host/wav2c.py)
+typedef struct {
+  uint8_t format;
+  uint32_t length;                     // Em amostras
+  const uint8_t *data;
+} audio_sample_t;
+
+// Nota de uma música tocada como onda quadrada; freq 0 = pausa
+typedef struct {
+  uint16_t freq;
+  uint16_t ms;
+} audio_note_t;
+
+typedef enum {
+  AUDIO_VOICE_IDLE,
+  AUDIO_VOICE_SAMPLE,
+  AUDIO_VOICE_SONG
+} audio_voice_kind_t;
+
+typedef struct {
+  volatile uint8_t kind;               // Escrito por último: a interrupção só lê vozes prontas
+  uint8_t volume;                      // 0 a 255
+  bool loop;
+  uint32_t position;                   // Amostra ou nota atual
+  // Amostra
+  const audio_sample_t *sample;
+  int16_t predictor;                   // Estado do ADPCM
+  int8_t index;
+  // Música
+  const audio_note_t *notes;
+  uint16_t count;
+  uint32_t remaining;                  // Amostras restantes da nota atual
+  uint32_t phase, step;
+} audio_voice_t;
+
+typedef struct {
+  int dma[AUDIO_LANES][2];             // Canal de DMA por buzzer e por buffer
+  uint slice[AUDIO_LANES];
+  uint16_t buffer[2][AUDIO_BUFFER];
+  uint8_t done[2];                     // Buzzers que já terminaram cada buffer
+  uint8_t bias;                        // Nível de repouso atual do PWM (0 sem vozes)
+  audio_voice_t voices[AUDIO_VOICES];
+  uint32_t mix_us, mix_us_max;         // Tempo de mistura por buffer
+  uint32_t underruns;                  // Buffers reproduzidos antes de serem misturados
+} audio_t;
+
+void audio_init(audio_t *audio, uint pin_a, uint pin_b);
+void audio_play_sample(audio_t *audio, uint8_t voice, const audio_sample_t *sample, uint8_t volume);
+void audio_play_song(audio_t *audio, uint8_t voice, const audio_note_t *notes, uint16_t count, uint8_t volume, bool loop);
+void audio_stop(audio_t *audio, uint8_t voice);
+
+#endif
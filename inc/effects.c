@@ -0,0 +1,119 @@
+#include "effects.h"
+
+// Cores em GRB, na mesma escala usada pelo jogo (80 = aceso)
+#define K 0, 0, 0       // Apagado
+#define W 80, 80, 80    // Branco
+#define Y 60, 80, 0     // Amarelo
+#define O 25, 80, 0     // Laranja
+#define R 0, 80, 0      // Vermelho
+#define D 0, 30, 0      // Vermelho fraco
+#define B 0, 0, 80      // Azul
+#define C 40, 0, 60     // Azul claro
+
+// Quadros-chave em ordem visual: uma linha da matriz por linha do código
+
+static const anim_frame_t explosion_frames[] = {
+  {K, K, W, K, K,
+   K, K, W, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {K, Y, W, Y, K,
+   K, O, Y, O, K,
+   K, K, O, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {O, R, O, R, O,
+   R, O, R, O, R,
+   K, R, O, R, K,
+   K, K, D, K, K,
+   K, K, K, K, K},
+  {D, K, D, K, D,
+   K, D, K, D, K,
+   D, K, D, K, D,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+};
+
+const anim_effect_t fx_explosion = {explosion_frames, count_of(explosion_frames), 70, ANIM_BLEND_ADD, 255};
+
+static const anim_frame_t hit_frames[] = {
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, D, K, K,
+   K, R, R, R, K,
+   R, R, W, R, R},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, D, R, D, K,
+   D, R, R, R, D},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+};
+
+const anim_effect_t fx_hit = {hit_frames, count_of(hit_frames), 90, ANIM_BLEND_ADD, 255};
+
+static const anim_frame_t level_frames[] = {
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   B, B, B, B, B},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   B, B, B, B, B,
+   C, C, C, C, C},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   B, B, B, B, B,
+   C, C, C, C, C,
+   K, K, K, K, K},
+  {K, K, K, K, K,
+   B, B, B, B, B,
+   C, C, C, C, C,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {B, B, B, B, B,
+   C, C, C, C, C,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {C, C, C, C, C,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+};
+
+const anim_effect_t fx_level = {level_frames, count_of(level_frames), 60, ANIM_BLEND_ALPHA, 200};
+
+// Dois quadros-chave: a interpolação faz o apagamento gradual
+static const anim_frame_t game_over_frames[] = {
+  {R, R, R, R, R,
+   R, R, R, R, R,
+   R, R, R, R, R,
+   R, R, R, R, R,
+   R, R, R, R, R},
+  {K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K,
+   K, K, K, K, K},
+};
+
+const anim_effect_t fx_game_over = {game_over_frames, count_of(game_over_frames), 800, ANIM_BLEND_ADD, 255};
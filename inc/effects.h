@@ -0,0 +1,12 @@
+#ifndef EFFECTS_H
+#define EFFECTS_H
+
+#include "anim.h"
+
+// Efeitos da matriz de LEDs, centrados na coluna 2 (deslocar com anim_play)
+extern const anim_effect_t fx_explosion; // Inimigo atingido (linhas do inimigo)
+extern const anim_effect_t fx_hit;       // Jogador atingido no versus (linhas do jogador)
+extern const anim_effect_t fx_level;     // Início da partida: faixa azul subindo
+extern const anim_effect_t fx_game_over; // Fim da partida: vermelho apagando
+
+#endif
@@ -0,0 +1,231 @@
+#include <string.h>
+#include "i2c_sched.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+#define I2C_SCHED_TX_THRESHOLD 4       // Interrupção quando a FIFO de envio cai a 4 comandos
+
+static i2c_sched_t *i2c_sched_instances[2];
+
+// Escolhe o próximo bloco: o primeiro dispositivo (mais urgente) com transação na fila
+static void __not_in_flash_func(i2c_sched_next)(i2c_sched_t *sched) {
+  i2c_txn_t *txn = NULL;
+  for (i2c_device_t *device = sched->devices; device; device = device->next) {
+    if (device->head) {
+      txn = device->head;
+      break;
+    }
+  }
+
+  i2c_hw_t *hw = i2c_get_hw(sched->i2c);
+  sched->current = txn;
+  if (!txn) {
+    hw->intr_mask = 0;
+    return;
+  }
+
+  // Outra transação ainda pela metade ficou para trás
+  for (i2c_device_t *device = sched->devices; device; device = device->next)
+    if (device->head && device->head != txn && device->head->state == I2C_TXN_ACTIVE)
+      sched->preemptions++;
+
+  uint16_t remaining = txn->len - txn->offset;
+  sched->chunk_len = txn->chunk && txn->chunk < remaining ? txn->chunk : remaining;
+  bool last = txn->offset + sched->chunk_len == txn->len;
+  sched->total = txn->prefix_len + sched->chunk_len + (last ? txn->rx_len : 0);
+  sched->issued = 0;
+  sched->received = 0;
+  sched->aborted = false;
+  txn->state = I2C_TXN_ACTIVE;
+
+  // O endereço só pode mudar com o controlador desabilitado (barramento livre entre blocos)
+  if (sched->tar != txn->device->address) {
+    hw->enable = 0;
+    hw->tar = txn->device->address;
+    hw->enable = 1;
+    sched->tar = txn->device->address;
+  }
+
+  sched->chunk_start_us = time_us_32();
+  hw->intr_mask = I2C_IC_INTR_MASK_M_TX_EMPTY_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS |
+                  I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_RX_FULL_BITS;
+}
+
+// Coloca na FIFO os comandos do bloco atual: prefixo, dados e leituras; STOP no último
+static void __not_in_flash_func(i2c_sched_fill)(i2c_sched_t *sched, i2c_hw_t *hw) {
+  i2c_txn_t *txn = sched->current;
+  uint16_t written = txn->prefix_len + sched->chunk_len;
+
+  while (sched->issued < sched->total && hw->txflr < I2C_SCHED_FIFO) {
+    uint16_t i = sched->issued;
+    uint32_t cmd;
+    if (i < txn->prefix_len)
+      cmd = txn->prefix[i];
+    else if (i < written)
+      cmd = txn->data[txn->offset + i - txn->prefix_len];
+    else
+      cmd = I2C_IC_DATA_CMD_CMD_BITS | (i == written && written ? I2C_IC_DATA_CMD_RESTART_BITS : 0);
+    if (i + 1 == sched->total)
+      cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+    hw->data_cmd = cmd;
+    sched->issued++;
+  }
+
+  if (sched->issued == sched->total)
+    hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+}
+
+// Fim de um bloco (STOP detectado): contabiliza e, se a transação acabou,
+// retira da fila e chama o callback. Em seguida escolhe o próximo bloco.
+static void __not_in_flash_func(i2c_sched_chunk_done)(i2c_sched_t *sched) {
+  i2c_txn_t *txn = sched->current;
+  i2c_device_t *device = txn->device;
+
+  device->chunks++;
+  device->bytes += sched->issued;
+  device->busy_us += time_us_32() - sched->chunk_start_us;
+
+  bool finished = sched->aborted;
+  if (!sched->aborted) {
+    txn->offset += sched->chunk_len;
+    finished = txn->offset == txn->len;
+  }
+
+  if (finished) {
+    device->head = txn->next;
+    if (!device->head)
+      device->tail = NULL;
+    if (sched->aborted) {
+      device->errors++;
+      txn->result = -1;
+    } else {
+      device->transactions++;
+      txn->result = txn->len + txn->rx_len;
+    }
+    txn->state = I2C_TXN_DONE;
+    if (txn->done)
+      txn->done(txn, txn->ctx);
+  }
+
+  i2c_sched_next(sched);
+}
+
+static void __not_in_flash_func(i2c_sched_irq)(i2c_sched_t *sched) {
+  i2c_hw_t *hw = i2c_get_hw(sched->i2c);
+  uint32_t status = hw->intr_stat;
+
+  if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+    (void)hw->clr_tx_abrt; // NACK ou perda de arbitragem: a FIFO é descartada e o STOP vem a seguir
+    sched->aborted = true;
+    hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+  }
+
+  if (sched->current) {
+    while (hw->rxflr && sched->received < sched->current->rx_len)
+      sched->current->rx[sched->received++] = hw->data_cmd;
+  }
+
+  if ((status & I2C_IC_INTR_STAT_R_TX_EMPTY_BITS) && sched->current && !sched->aborted)
+    i2c_sched_fill(sched, hw);
+
+  if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+    (void)hw->clr_stop_det;
+    if (sched->current)
+      i2c_sched_chunk_done(sched);
+  }
+}
+
+static void __not_in_flash_func(i2c0_sched_irq)() {
+  i2c_sched_irq(i2c_sched_instances[0]);
+}
+
+static void __not_in_flash_func(i2c1_sched_irq)() {
+  i2c_sched_irq(i2c_sched_instances[1]);
+}
+
+// O controlador já deve estar inicializado com i2c_init (velocidade e pinos)
+void i2c_sched_init(i2c_sched_t *sched, i2c_inst_t *i2c) {
+  memset(sched, 0, sizeof(*sched));
+  sched->i2c = i2c;
+  sched->tar = 0xFF;
+
+  i2c_hw_t *hw = i2c_get_hw(i2c);
+  hw->intr_mask = 0;
+  hw->tx_tl = I2C_SCHED_TX_THRESHOLD;
+  hw->rx_tl = 0; // Cada byte lido gera interrupção
+
+  uint index = i2c_hw_index(i2c);
+  i2c_sched_instances[index] = sched;
+  irq_set_exclusive_handler(I2C0_IRQ + index, index ? i2c1_sched_irq : i2c0_sched_irq);
+  irq_set_enabled(I2C0_IRQ + index, true);
+}
+
+// Registra o dispositivo mantendo a lista ordenada por prioridade
+void i2c_sched_add_device(i2c_sched_t *sched, i2c_device_t *device, uint8_t address, uint8_t priority) {
+  memset(device, 0, sizeof(*device));
+  device->address = address;
+  device->priority = priority;
+
+  uint32_t irq = save_and_disable_interrupts();
+  i2c_device_t **link = &sched->devices;
+  while (*link && (*link)->priority <= priority)
+    link = &(*link)->next;
+  device->next = *link;
+  *link = device;
+  restore_interrupts(irq);
+}
+
+void i2c_txn_init(i2c_txn_t *txn, i2c_device_t *device, const uint8_t *prefix, uint8_t prefix_len,
+                  const uint8_t *data, uint16_t len, uint16_t chunk) {
+  hard_assert(prefix_len <= I2C_SCHED_PREFIX_MAX);
+  memset(txn, 0, sizeof(*txn));
+  txn->device = device;
+  if (prefix_len)
+    memcpy(txn->prefix, prefix, prefix_len);
+  txn->prefix_len = prefix_len;
+  txn->data = data;
+  txn->len = len;
+  txn->chunk = chunk;
+}
+
+// Enfileira a transação no seu dispositivo; com o barramento livre ela começa na hora
+void i2c_sched_submit(i2c_sched_t *sched, i2c_txn_t *txn) {
+  hard_assert(txn->prefix_len + txn->len + txn->rx_len > 0);
+  txn->offset = 0;
+  txn->result = 0;
+  txn->next = NULL;
+  txn->state = I2C_TXN_QUEUED;
+
+  uint32_t irq = save_and_disable_interrupts();
+  i2c_device_t *device = txn->device;
+  if (device->tail)
+    device->tail->next = txn;
+  else
+    device->head = txn;
+  device->tail = txn;
+
+  if (!sched->current)
+    i2c_sched_next(sched); // A interrupção de FIFO vazia começa o envio
+  restore_interrupts(irq);
+}
+
+bool i2c_txn_busy(const i2c_txn_t *txn) {
+  return txn->state == I2C_TXN_QUEUED || txn->state == I2C_TXN_ACTIVE;
+}
+
+void i2c_txn_wait(const i2c_txn_t *txn) {
+  while (i2c_txn_busy(txn))
+    tight_loop_contents();
+}
+
+// Escrita seguida de leitura (ex.: registrador de um sensor), esperando o fim
+int i2c_sched_write_read_blocking(i2c_sched_t *sched, i2c_device_t *device, const uint8_t *src, uint16_t len,
+                                  uint8_t *dst, uint16_t rx_len) {
+  i2c_txn_t txn;
+  i2c_txn_init(&txn, device, NULL, 0, src, len, 0);
+  txn.rx = dst;
+  txn.rx_len = rx_len;
+  i2c_sched_submit(sched, &txn);
+  i2c_txn_wait(&txn);
+  return txn.result;
+}
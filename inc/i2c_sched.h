@@ -0,0 +1,81 @@
+#ifndef I2C_SCHED_H
+#define I2C_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+// Fila de transações I2C atendida pela interrupção do controlador: o código
+// enfileira a transação e segue; a FIFO de 16 posições do DW_apb_i2c é
+// reabastecida na interrupção. Escritas grandes são divididas em blocos (cada
+// um com START, endereço, prefixo e STOP) e, entre um bloco e outro, o
+// dispositivo de maior prioridade com transação pendente assume o barramento.
+// As transações de um mesmo dispositivo são atendidas em ordem.
+
+#define I2C_SCHED_FIFO 16
+#define I2C_SCHED_PREFIX_MAX 2
+
+typedef enum {
+  I2C_TXN_IDLE,                        // Livre para reutilizar
+  I2C_TXN_QUEUED,
+  I2C_TXN_ACTIVE,                      // Algum bloco já foi enviado
+  I2C_TXN_DONE
+} i2c_txn_state_t;
+
+typedef struct i2c_txn i2c_txn_t;
+typedef struct i2c_device i2c_device_t;
+
+struct i2c_txn {
+  i2c_device_t *device;
+  uint8_t prefix[I2C_SCHED_PREFIX_MAX]; // Repetido no início de cada bloco (ex.: 0x40 do SSD1306)
+  uint8_t prefix_len;
+  const uint8_t *data;                 // Deve continuar válido até a transação terminar
+  uint16_t len;
+  uint16_t chunk;                      // Bytes de 'data' por bloco (0 = tudo de uma vez)
+  uint8_t *rx;                         // Leitura após a escrita, com START repetido (ou NULL)
+  uint16_t rx_len;
+  void (*done)(i2c_txn_t *txn, void *ctx); // Chamada na interrupção ao terminar
+  void *ctx;
+  int result;                          // Bytes transferidos ou -1 (NACK/perda de arbitragem)
+  volatile uint8_t state;
+  uint16_t offset;                     // Bytes de 'data' já enviados
+  i2c_txn_t *next;
+};
+
+struct i2c_device {
+  uint8_t address;
+  uint8_t priority;                    // 0 = mais urgente
+  i2c_txn_t *head, *tail;
+  i2c_device_t *next;                  // Lista de dispositivos por prioridade
+  // Uso do barramento
+  uint32_t transactions;
+  uint32_t chunks;
+  uint32_t bytes;                      // Bytes escritos e lidos (sem o endereço)
+  uint32_t busy_us;                    // Tempo com o barramento ocupado
+  uint32_t errors;
+};
+
+typedef struct {
+  i2c_inst_t *i2c;
+  i2c_device_t *devices;
+  i2c_txn_t *current;                  // Transação com um bloco no barramento
+  uint16_t chunk_len;                  // Bytes de 'data' no bloco atual
+  uint16_t total, issued, received;    // Comandos do bloco atual (escrita + leitura)
+  uint8_t tar;                         // Endereço programado no controlador
+  bool aborted;
+  uint32_t chunk_start_us;
+  uint32_t preemptions;                // Blocos em que outro dispositivo passou à frente
+} i2c_sched_t;
+
+void i2c_sched_init(i2c_sched_t *sched, i2c_inst_t *i2c);
+void i2c_sched_add_device(i2c_sched_t *sched, i2c_device_t *device, uint8_t address, uint8_t priority);
+void i2c_txn_init(i2c_txn_t *txn, i2c_device_t *device, const uint8_t *prefix, uint8_t prefix_len,
+                  const uint8_t *data, uint16_t len, uint16_t chunk);
+void i2c_sched_submit(i2c_sched_t *sched, i2c_txn_t *txn);
+bool i2c_txn_busy(const i2c_txn_t *txn);
+void i2c_txn_wait(const i2c_txn_t *txn);
+int i2c_sched_write_read_blocking(i2c_sched_t *sched, i2c_device_t *device, const uint8_t *src, uint16_t len,
+                                  uint8_t *dst, uint16_t rx_len);
+
+#endif
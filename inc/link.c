@@ -0,0 +1,292 @@
+#include <string.h>
+#include "link.h"
+
+#define LINK_MASK (LINK_HISTORY - 1)
+
+#if LINK_HISTORY > 32
+#error "LINK_HISTORY precisa caber na máscara 'resent'"
+#endif
+
+// CRC-16/CCITT (polinômio 0x1021) sobre os campos do quadro. Com bytes
+// perdidos, pedaços de quadros vizinhos formam quadros falsos com frequência;
+// 16 bits tornam a aceitação de um deles desprezível.
+uint16_t link_crc16(const uint8_t *data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  while (len--) {
+    crc ^= (uint16_t)*data++ << 8;
+    for (uint8_t i = 0; i < 8; ++i)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+// Reconstrói o valor de 16 bits de seq/ack a partir dos 8 bits do quadro,
+// escolhendo o mais próximo de 'reference'
+static uint16_t link_extend(uint8_t value, uint16_t reference) {
+  return reference + (int8_t)(value - (uint8_t)reference);
+}
+
+static void link_send(link_t *link, uint16_t seq) {
+  uint8_t frame[LINK_FRAME_SIZE];
+  frame[0] = LINK_SYNC;
+  frame[1] = seq;
+  frame[2] = link->remote_seq;
+  for (uint8_t k = 0; k < 3; ++k)
+    frame[3 + k] = link->local[(uint16_t)(seq - k) & LINK_MASK];
+  uint16_t crc = link_crc16(&frame[1], 5);
+  frame[6] = crc >> 8;
+  frame[7] = crc;
+
+  link->io.write(link->io.ctx, frame, sizeof(frame));
+  link->last_send_us = link->io.now_us(link->io.ctx);
+  link->tick_bytes_sent += sizeof(frame);
+  link->stats.frames_sent++;
+  link->stats.bytes_sent += sizeof(frame);
+}
+
+// Quadros de apresentação e de despedida: sincronismo, nonce e um byte extra
+static void link_send_nonce(link_t *link, uint8_t sync, uint8_t extra) {
+  uint8_t frame[LINK_FRAME_SIZE];
+  frame[0] = sync;
+  frame[1] = link->nonce >> 24;
+  frame[2] = link->nonce >> 16;
+  frame[3] = link->nonce >> 8;
+  frame[4] = link->nonce;
+  frame[5] = extra;
+  uint16_t crc = link_crc16(&frame[1], 5);
+  frame[6] = crc >> 8;
+  frame[7] = crc;
+
+  link->io.write(link->io.ctx, frame, sizeof(frame));
+  link->last_send_us = link->io.now_us(link->io.ctx);
+  link->tick_bytes_sent += sizeof(frame);
+  link->stats.frames_sent++;
+  link->stats.bytes_sent += sizeof(frame);
+}
+
+// Quadro de apresentação; 'known' indica que o nonce do outro lado já chegou
+static void link_send_hello(link_t *link) {
+  link_send_nonce(link, LINK_HELLO, link->player >= 0);
+}
+
+static uint32_t link_frame_nonce(const uint8_t *frame) {
+  return (uint32_t)frame[1] << 24 | (uint32_t)frame[2] << 16 | frame[3] << 8 | frame[4];
+}
+
+// O menor nonce é o jogador 0. Nonces iguais não decidem nada: a apresentação
+// continua (improvável com nonces novos a cada sessão). Depois da apresentação,
+// um nonce diferente é o outro lado numa nova sessão: esta partida acabou.
+static void link_receive_hello(link_t *link, const uint8_t *frame) {
+  uint32_t nonce = link_frame_nonce(frame);
+  link->stats.frames_received++;
+  if (link->player >= 0 && nonce != link->peer_nonce) {
+    link->closed = true;
+    return;
+  }
+  if (link->player < 0 && nonce != link->nonce) {
+    link->peer_nonce = nonce;
+    link->player = link->nonce < nonce ? 0 : 1;
+  }
+  if (link->player >= 0)
+    link->last_receive_us = link->io.now_us(link->io.ctx);
+  if (!frame[5])
+    link_send_hello(link); // O outro lado ainda não tem o nosso nonce
+}
+
+// Despedida: só vale a do outro lado desta sessão
+static void link_receive_bye(link_t *link, const uint8_t *frame) {
+  link->stats.frames_received++;
+  if (link->player >= 0 && link_frame_nonce(frame) == link->peer_nonce)
+    link->closed = true;
+}
+
+// Quadro que cobre a primeira entrada local ainda não confirmada
+static uint16_t link_resend_seq(link_t *link) {
+  uint16_t seq = link->peer_ack + 2;
+  if ((int16_t)(seq - link->local_seq) >= 0)
+    seq = link->local_seq - 1;
+  return seq;
+}
+
+// Retransmite se há entradas locais sem confirmação há mais de LINK_RETRANSMIT_US
+static void link_retransmit(link_t *link) {
+  if (link->peer_ack == link->local_seq)
+    return;
+  if (link->io.now_us(link->io.ctx) - link->last_send_us <= LINK_RETRANSMIT_US)
+    return;
+
+  link_send(link, link_resend_seq(link));
+  for (uint16_t t = link->peer_ack; t != link->local_seq; ++t)
+    link->resent |= 1u << (t & LINK_MASK); // Todas as pendentes ficam fora da medição
+  link->stats.retransmits++;
+}
+
+static void link_receive(link_t *link, const uint8_t *frame) {
+  uint16_t seq = link_extend(frame[1], link->remote_seq);
+  uint16_t ack = link_extend(frame[2], link->peer_ack);
+  uint16_t before = link->remote_seq;
+
+  link->stats.frames_received++;
+  link->last_receive_us = link->io.now_us(link->io.ctx);
+
+  // Confirmação das entradas locais: mede a ida e volta da mais recente,
+  // ignorando entradas retransmitidas (o instante de envio seria ambíguo)
+  if ((int16_t)(ack - link->peer_ack) > 0 && (int16_t)(link->local_seq - ack) >= 0) {
+    uint8_t last = (ack - 1) & LINK_MASK;
+    link->peer_ack = ack;
+    if (!(link->resent & (1u << last))) {
+      uint32_t rtt = link->io.now_us(link->io.ctx) - link->sent_at[last];
+      link->stats.rtt_us = rtt;
+      if (rtt > link->stats.rtt_max_us)
+        link->stats.rtt_max_us = rtt;
+    }
+  }
+
+  // Aceita só entradas contíguas; lacunas maiores que a redundância esperam retransmissão
+  for (int8_t k = 2; k >= 0; --k) {
+    uint16_t t = seq - k;
+    if (t == link->remote_seq && (uint16_t)(t - link->tick) < LINK_HISTORY) {
+      link->remote[t & LINK_MASK] = frame[3 + k];
+      link->remote_seq++;
+    }
+  }
+
+  // Entrada nova: responde na hora, para o outro lado medir a ida e volta sem
+  // esperar pelo próximo tick. Quadro repetido: o outro lado não recebeu nossa
+  // confirmação; responde também, mas com intervalo mínimo para não ecoar.
+  if (link->remote_seq != before ||
+      link->io.now_us(link->io.ctx) - link->last_send_us > LINK_RETRANSMIT_US / 2)
+    link_send(link, link_resend_seq(link));
+}
+
+void link_init(link_t *link, const link_transport_t *io, uint8_t delay, uint32_t nonce) {
+  memset(link, 0, sizeof(*link));
+  link->io = *io;
+  link->nonce = nonce;
+  link->player = -1;
+  link->delay = delay > LINK_MAX_DELAY ? LINK_MAX_DELAY : delay;
+
+  // Os primeiros 'delay' ticks usam entrada neutra dos dois lados
+  link->local_seq = link->delay;
+  link->remote_seq = link->delay;
+  link->peer_ack = link->delay;
+}
+
+static void link_dispatch(link_t *link, const uint8_t *frame) {
+  if (link->closed)
+    return;
+  if (frame[0] == LINK_HELLO)
+    link_receive_hello(link, frame);
+  else if (frame[0] == LINK_BYE)
+    link_receive_bye(link, frame);
+  else
+    link_receive(link, frame);
+}
+
+static inline bool link_is_sync(uint8_t byte) {
+  return byte == LINK_SYNC || byte == LINK_HELLO || byte == LINK_BYE;
+}
+
+// Lê os bytes disponíveis e processa os quadros completos. Em caso de CRC
+// inválido, volta a procurar o sincronismo a partir do byte seguinte. Com a
+// partida encerrada, os quadros são lidos mas ignorados.
+void link_poll(link_t *link) {
+  int byte;
+  while ((byte = link->io.read(link->io.ctx)) >= 0) {
+    link->tick_bytes_received++;
+    link->stats.bytes_received++;
+
+    if (link->rx_len == 0 && !link_is_sync(byte)) {
+      link->stats.skipped_bytes++;
+      continue;
+    }
+    link->rx[link->rx_len++] = byte;
+    if (link->rx_len < LINK_FRAME_SIZE)
+      continue;
+
+    if (link_crc16(&link->rx[1], 5) == (link->rx[6] << 8 | link->rx[7])) {
+      link_dispatch(link, link->rx);
+      link->rx_len = 0;
+      continue;
+    }
+
+    link->stats.crc_errors++;
+    uint8_t next = 1;
+    while (next < LINK_FRAME_SIZE && !link_is_sync(link->rx[next]))
+      next++;
+    link->stats.skipped_bytes += next;
+    link->rx_len = LINK_FRAME_SIZE - next;
+    memmove(link->rx, &link->rx[next], link->rx_len);
+  }
+}
+
+// Avança um tick do lockstep. 'input' é a entrada local atual; ela só é
+// consumida quando ainda cabe na janela de atraso (e depois da apresentação).
+// Retorna true e as entradas do tick quando as duas estão disponíveis; com a
+// partida encerrada ('closed') retorna sempre false.
+bool link_update(link_t *link, uint8_t input, uint8_t *local, uint8_t *remote) {
+  link_poll(link);
+  if (link->closed)
+    return false;
+
+  // Sem papel definido ainda: repete a apresentação até o outro lado responder
+  if (link->player < 0) {
+    if (!link->stats.frames_sent ||
+        link->io.now_us(link->io.ctx) - link->last_send_us > LINK_RETRANSMIT_US)
+      link_send_hello(link);
+    link->stats.stalls++;
+    return false;
+  }
+
+  if ((uint16_t)(link->local_seq - link->tick) <= link->delay) {
+    link->local[link->local_seq & LINK_MASK] = input;
+    link->sent_at[link->local_seq & LINK_MASK] = link->io.now_us(link->io.ctx);
+    link->resent &= ~(1u << (link->local_seq & LINK_MASK));
+    link_send(link, link->local_seq);
+    link->local_seq++;
+  }
+
+  link_retransmit(link);
+
+  if (link->remote_seq == link->tick) {
+    link->stats.stalls++; // Sem a entrada remota deste tick
+    if (link->io.now_us(link->io.ctx) - link->last_receive_us > LINK_TIMEOUT_US)
+      link->closed = true; // O outro lado sumiu sem se despedir
+    return false;
+  }
+
+  *local = link->local[link->tick & LINK_MASK];
+  *remote = link->remote[link->tick & LINK_MASK];
+  link->tick++;
+
+  link->stats.tick_bytes_sent = link->tick_bytes_sent;
+  link->stats.tick_bytes_received = link->tick_bytes_received;
+  link->tick_bytes_sent = 0;
+  link->tick_bytes_received = 0;
+  return true;
+}
+
+// Mantém o enlace (recepção e retransmissões) sem avançar ticks, por exemplo
+// ao encerrar a partida. Retorna true quando todas as entradas locais foram
+// confirmadas pelo outro lado.
+bool link_flush(link_t *link) {
+  link_poll(link);
+  if (link->closed)
+    return true;
+  link_retransmit(link);
+  return link->peer_ack == link->local_seq;
+}
+
+// Sai da partida: atende o outro lado até ele confirmar as entradas locais
+// (no máximo 'timeout_us') e envia a despedida, para ele encerrar também
+// em vez de esperar para sempre pelas próximas entradas.
+void link_close(link_t *link, uint32_t timeout_us) {
+  uint32_t start = link->io.now_us(link->io.ctx);
+  while (!link_flush(link) && link->io.now_us(link->io.ctx) - start < timeout_us)
+    ;
+  if (!link->closed && link->player >= 0) {
+    for (uint8_t i = 0; i < LINK_BYE_REPEAT; ++i)
+      link_send_nonce(link, LINK_BYE, 0);
+  }
+  link->closed = true;
+}
@@ -0,0 +1,93 @@
+#ifndef LINK_H
+#define LINK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Enlace entre duas placas em lockstep: a cada tick cada lado envia sua
+// entrada e só avança a simulação quando tem as entradas dos dois jogadores
+// para aquele tick. Não depende do SDK do Pico, para rodar também no Linux.
+//
+// Quadro (8 bytes):
+//   [0xA5][seq][ack][entrada seq][entrada seq-1][entrada seq-2][CRC-16]
+// seq e ack são os 8 bits baixos do tick. Cada quadro repete as duas entradas
+// anteriores, então até dois quadros perdidos se recuperam sem retransmissão.
+//
+// Antes do primeiro tick os lados trocam um quadro de apresentação:
+//   [0x5A][nonce (4 bytes)][já tenho o seu nonce][CRC-16]
+// O lado de menor nonce é o jogador 0 e o outro o jogador 1, então as duas
+// placas chamam as regras com as entradas na mesma ordem.
+//
+// Ao sair da partida o lado envia quadros de despedida:
+//   [0x5B][nonce (4 bytes)][0][CRC-16]
+// O outro lado encerra também. Sem despedida, a partida termina quando nada
+// chega por LINK_TIMEOUT_US, ou quando chega a apresentação de uma nova
+// sessão (o outro lado saiu e voltou ao VERSUS).
+
+#define LINK_SYNC 0xA5
+#define LINK_HELLO 0x5A
+#define LINK_BYE 0x5B
+#define LINK_FRAME_SIZE 8
+#define LINK_HISTORY 32            // Ticks guardados (potência de 2, > 2 * atraso + 2)
+#define LINK_MAX_DELAY 8           // Atraso de entrada máximo, em ticks
+#define LINK_RETRANSMIT_US 30000   // Tempo sem progresso até retransmitir
+#define LINK_POLL_US 500           // Intervalo de leitura do enlace entre ticks (ida e volta < 1 tick)
+#define LINK_TIMEOUT_US 1000000    // Tempo sem nenhum quadro até dar o outro lado como perdido
+#define LINK_BYE_REPEAT 3          // Cópias do quadro de despedida
+
+// Entrada de um tick
+#define LINK_INPUT_LANE 0x07       // Posição do jogador (1 a 5)
+#define LINK_INPUT_FIRE 0x08       // Disparo neste tick
+
+// Transporte (UART no Pico, pseudo-terminal no Linux)
+typedef struct {
+  void (*write)(void *ctx, const uint8_t *data, size_t len);
+  int (*read)(void *ctx);          // Próximo byte recebido ou -1
+  uint32_t (*now_us)(void *ctx);
+  void *ctx;
+} link_transport_t;
+
+typedef struct {
+  uint32_t frames_sent, frames_received;
+  uint32_t bytes_sent, bytes_received;
+  uint32_t crc_errors;             // Quadros descartados por CRC
+  uint32_t skipped_bytes;          // Bytes descartados até achar o sincronismo
+  uint32_t retransmits;
+  uint32_t stalls;                 // Ticks em que faltou a entrada remota
+  uint32_t rtt_us, rtt_max_us;     // Ida e volta do último quadro confirmado (sem retransmissões)
+  uint16_t tick_bytes_sent;        // Bytes enviados no último tick
+  uint16_t tick_bytes_received;    // Bytes recebidos no último tick
+} link_stats_t;
+
+typedef struct {
+  link_transport_t io;
+  uint32_t nonce;                  // Identidade deste lado (diferente nas duas pontas)
+  uint32_t peer_nonce;
+  int8_t player;                   // 0 ou 1 depois da apresentação; -1 antes
+  bool closed;                     // Partida encerrada (por este lado ou pelo outro)
+  uint8_t delay;                   // Atraso de entrada, em ticks
+  uint16_t tick;                   // Próximo tick a simular
+  uint16_t local_seq;              // Próximo tick cuja entrada local será enviada
+  uint16_t remote_seq;             // Entradas remotas contíguas recebidas
+  uint16_t peer_ack;               // Entradas locais confirmadas pelo outro lado
+  uint8_t local[LINK_HISTORY];
+  uint8_t remote[LINK_HISTORY];
+  uint32_t sent_at[LINK_HISTORY];  // Instante de envio de cada entrada local
+  uint32_t resent;                 // Entradas retransmitidas (um bit por posição do histórico)
+  uint32_t last_send_us;
+  uint32_t last_receive_us;        // Último quadro válido do outro lado
+  uint8_t rx[LINK_FRAME_SIZE];
+  uint8_t rx_len;
+  uint16_t tick_bytes_sent, tick_bytes_received;
+  link_stats_t stats;
+} link_t;
+
+void link_init(link_t *link, const link_transport_t *io, uint8_t delay, uint32_t nonce);
+void link_poll(link_t *link);
+bool link_update(link_t *link, uint8_t input, uint8_t *local, uint8_t *remote);
+bool link_flush(link_t *link);
+void link_close(link_t *link, uint32_t timeout_us);
+uint16_t link_crc16(const uint8_t *data, size_t len);
+
+#endif
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <string.h>
+#include "menu.h"
+
+// Menu em modo retido: a tela só é desenhada ao abrir e, depois disso, cada
+// evento redesenha e envia apenas os widgets afetados (marcadores e valores).
+// Sem eventos não há desenho nem tráfego I2C.
+
+#define MENU_MARKER_X 20  // Coluna dos marcadores de seleção
+#define MENU_LABEL_X 32   // Coluna dos rótulos
+#define MENU_VALUE_X 96   // Coluna dos valores ajustáveis
+#define MENU_ROW_HEIGHT 9 // Altura de cada linha
+#define MENU_BOTTOM 58    // Última linha útil dentro da borda
+
+static uint8_t menu_first_row(const menu_t *menu) {
+  return menu->screen->title ? 20 : 12;
+}
+
+static uint8_t menu_visible(const menu_t *menu) {
+  return (MENU_BOTTOM - menu_first_row(menu)) / MENU_ROW_HEIGHT;
+}
+
+static uint8_t menu_row_y(const menu_t *menu, uint8_t index) {
+  return menu_first_row(menu) + (index - menu->first) * MENU_ROW_HEIGHT;
+}
+
+static void menu_draw_marker(menu_t *menu, uint8_t index) {
+  uint8_t y = menu_row_y(menu, index);
+  ssd1306_rect(menu->ssd, y, MENU_MARKER_X, 7, 7, false, true);
+  ssd1306_rect(menu->ssd, y, MENU_MARKER_X, 7, 7, true, index == menu->selected);
+}
+
+static void menu_draw_value(menu_t *menu, uint8_t index) {
+  const menu_item_t *item = &menu->screen->items[index];
+  char buffer[4];
+  uint8_t y = menu_row_y(menu, index);
+
+  snprintf(buffer, sizeof(buffer), "%u", *item->value);
+  ssd1306_rect(menu->ssd, y, MENU_VALUE_X, 24, 8, false, true);
+  ssd1306_draw_string(menu->ssd, buffer, MENU_VALUE_X, y);
+}
+
+// Envia só as colunas x0..x1 das linhas y0..y1
+static void menu_flush(menu_t *menu, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1) {
+  ssd1306_send_area(menu->ssd, x0, x1, y0 / 8, y1 / 8);
+}
+
+// Desenha as entradas visíveis (rótulos, valores e marcadores)
+static void menu_draw_items(menu_t *menu) {
+  uint8_t first_row = menu_first_row(menu);
+  uint8_t last = MIN(menu->screen->count, menu->first + menu_visible(menu));
+
+  ssd1306_rect(menu->ssd, first_row, 4, 120, MENU_BOTTOM - first_row, false, true);
+  for (uint8_t i = menu->first; i < last; ++i) {
+    const menu_item_t *item = &menu->screen->items[i];
+    ssd1306_draw_string(menu->ssd, item->label, MENU_LABEL_X, menu_row_y(menu, i));
+    if (item->value)
+      menu_draw_value(menu, i);
+    menu_draw_marker(menu, i);
+  }
+}
+
+void menu_init(menu_t *menu, ssd1306_t *ssd, void (*on_action)(menu_t *menu, const menu_item_t *item)) {
+  menu->ssd = ssd;
+  menu->screen = NULL;
+  menu->selected = 0;
+  menu->first = 0;
+  menu->on_action = on_action;
+}
+
+// Troca de tela: único ponto em que o quadro inteiro é redesenhado e enviado
+void menu_open(menu_t *menu, const menu_screen_t *screen) {
+  menu->screen = screen;
+  menu->selected = 0;
+  menu->first = 0;
+
+  ssd1306_fill(menu->ssd, false);
+  ssd1306_rect(menu->ssd, 3, 3, 122, 58, true, false); // Borda fixa
+  if (screen->title)
+    ssd1306_draw_string(menu->ssd, screen->title, (menu->ssd->width - 8 * strlen(screen->title)) / 2, 8);
+  if (screen->count)
+    menu_draw_items(menu);
+  if (screen->draw)
+    screen->draw(menu->ssd);
+  ssd1306_send_data(menu->ssd);
+}
+
+// Move a seleção, redesenhando só os dois marcadores (ou a lista, se ela rolar)
+static void menu_move(menu_t *menu, int8_t step) {
+  uint8_t count = menu->screen->count;
+  uint8_t previous = menu->selected;
+  if (count < 2)
+    return;
+
+  menu->selected = (menu->selected + count + step) % count;
+
+  uint8_t visible = menu_visible(menu);
+  if (menu->selected < menu->first || menu->selected >= menu->first + visible) {
+    menu->first = menu->selected < menu->first ? menu->selected : menu->selected - visible + 1;
+    menu_draw_items(menu);
+    menu_flush(menu, 4, 123, menu_first_row(menu), MENU_BOTTOM - 1);
+    return;
+  }
+
+  menu_draw_marker(menu, previous);
+  menu_draw_marker(menu, menu->selected);
+  uint8_t y0 = menu_row_y(menu, MIN(previous, menu->selected));
+  uint8_t y1 = menu_row_y(menu, MAX(previous, menu->selected)) + 6;
+  menu_flush(menu, MENU_MARKER_X, MENU_MARKER_X + 6, y0, y1);
+}
+
+// Ajusta o valor da entrada selecionada, redesenhando só o número
+static void menu_adjust(menu_t *menu, int8_t step) {
+  const menu_item_t *item = &menu->screen->items[menu->selected];
+  int16_t value = *item->value + step;
+  if (value < item->min || value > item->max)
+    return;
+
+  *item->value = value;
+  menu_draw_value(menu, menu->selected);
+  uint8_t y = menu_row_y(menu, menu->selected);
+  menu_flush(menu, MENU_VALUE_X, MENU_VALUE_X + 23, y, y + 7);
+  if (item->action && menu->on_action)
+    menu->on_action(menu, item);
+}
+
+void menu_handle(menu_t *menu, menu_event_t event) {
+  const menu_screen_t *screen = menu->screen;
+  const menu_item_t *item = screen->count ? &screen->items[menu->selected] : NULL;
+
+  switch (event) {
+    case MENU_EVENT_UP:
+      menu_move(menu, -1);
+      break;
+    case MENU_EVENT_DOWN:
+      menu_move(menu, 1);
+      break;
+    case MENU_EVENT_LEFT:
+    case MENU_EVENT_RIGHT:
+      if (item && item->value)
+        menu_adjust(menu, event == MENU_EVENT_RIGHT ? 1 : -1);
+      break;
+    case MENU_EVENT_SELECT:
+      if (item && item->target)
+        menu_open(menu, item->target);
+      else if (item && item->action && !item->value && menu->on_action)
+        menu->on_action(menu, item);
+      else if (!item && screen->parent)
+        menu_open(menu, screen->parent); // Telas fixas voltam com o botão A
+      break;
+    case MENU_EVENT_BACK:
+      if (screen->parent)
+        menu_open(menu, screen->parent);
+      break;
+    default:
+      break;
+  }
+}
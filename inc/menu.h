@@ -0,0 +1,50 @@
+#ifndef MENU_H
+#define MENU_H
+
+#include "ssd1306.h"
+
+// Eventos de entrada entregues ao menu (já filtrados por borda)
+typedef enum {
+  MENU_EVENT_NONE,
+  MENU_EVENT_UP,
+  MENU_EVENT_DOWN,
+  MENU_EVENT_LEFT,
+  MENU_EVENT_RIGHT,
+  MENU_EVENT_SELECT,
+  MENU_EVENT_BACK
+} menu_event_t;
+
+typedef struct menu_screen menu_screen_t;
+typedef struct menu menu_t;
+
+// Entrada de um menu: abre outra tela, dispara uma ação ou ajusta um valor
+typedef struct {
+  const char *label;
+  const menu_screen_t *target; // Tela aberta ao selecionar (ou NULL)
+  uint8_t action;              // Ação entregue a on_action (0 = nenhuma)
+  uint8_t *value;              // Valor ajustado com esquerda/direita (ou NULL)
+  uint8_t min, max;
+} menu_item_t;
+
+// Tela do menu: lista de entradas ou tela fixa desenhada por 'draw'
+struct menu_screen {
+  const char *title;
+  const menu_item_t *items;
+  uint8_t count;
+  const menu_screen_t *parent;
+  void (*draw)(ssd1306_t *ssd); // Conteúdo de telas sem entradas (sobre, placar)
+};
+
+struct menu {
+  ssd1306_t *ssd;
+  const menu_screen_t *screen;
+  uint8_t selected; // Entrada selecionada
+  uint8_t first;    // Primeira entrada visível
+  void (*on_action)(menu_t *menu, const menu_item_t *item);
+};
+
+void menu_init(menu_t *menu, ssd1306_t *ssd, void (*on_action)(menu_t *menu, const menu_item_t *item));
+void menu_open(menu_t *menu, const menu_screen_t *screen);
+void menu_handle(menu_t *menu, menu_event_t event);
+
+#endif
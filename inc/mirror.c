@@ -0,0 +1,129 @@
+#include <string.h>
+#include "mirror.h"
+#include "link.h"
+
+#define MIRROR_ALL_CHANNELS ((1u << MIRROR_CHANNELS) - 1)
+
+// Comprime com PackBits: n = 0..127 -> n + 1 bytes literais; n = 129..255 ->
+// o byte seguinte repetido 257 - n vezes. Repetições só interrompem um trecho
+// literal a partir de 3 bytes, então a saída nunca passa de len + len / 128 + 1.
+size_t mirror_packbits(const uint8_t *data, size_t len, uint8_t *out) {
+  size_t i = 0, n = 0;
+  while (i < len) {
+    size_t run = 1;
+    while (i + run < len && run < 128 && data[i + run] == data[i])
+      run++;
+
+    if (run >= 3) {
+      out[n++] = (uint8_t)(257 - run);
+      out[n++] = data[i];
+      i += run;
+      continue;
+    }
+
+    size_t start = i, count = 0;
+    while (i < len && count < 128) {
+      if (i + 2 < len && data[i] == data[i + 1] && data[i] == data[i + 2])
+        break;
+      i++;
+      count++;
+    }
+    out[n++] = (uint8_t)(count - 1);
+    memcpy(&out[n], &data[start], count);
+    n += count;
+  }
+  return n;
+}
+
+void mirror_init(mirror_t *mirror, const mirror_transport_t *io) {
+  memset(mirror, 0, sizeof(*mirror));
+  mirror->io = *io;
+  mirror->key = MIRROR_ALL_CHANNELS;
+  mirror->key_countdown = MIRROR_KEY_FRAMES;
+}
+
+// Reenvia tudo como quadro-chave (ex.: um visualizador acabou de conectar)
+void mirror_request_key(mirror_t *mirror) {
+  mirror->key = MIRROR_ALL_CHANNELS;
+  mirror->key_countdown = MIRROR_KEY_FRAMES;
+}
+
+// Conteúdo atual de um canal. O framebuffer do SSD1306 está em endereçamento
+// vertical (índice 1 + x * páginas + página); o visualizador recebe cada
+// página como 128 colunas.
+static uint8_t mirror_channel(const uint8_t *ram_buffer, const uint8_t *leds, uint8_t channel, uint8_t *out) {
+  if (channel == MIRROR_CHANNEL_LEDS) {
+    memcpy(out, leds, MIRROR_LED_BYTES);
+    return MIRROR_LED_BYTES;
+  }
+  for (uint8_t x = 0; x < MIRROR_WIDTH; ++x)
+    out[x] = ram_buffer[1 + x * MIRROR_PAGES + channel];
+  return MIRROR_WIDTH;
+}
+
+// Envia os canais alterados sem bloquear: cada pacote só é escrito se couber
+// inteiro no espaço livre do transporte e no orçamento do quadro. Canais que
+// não couberem continuam diferentes da cópia e saem nos próximos quadros,
+// começando por eles. Retorna os bytes enviados.
+uint16_t mirror_update(mirror_t *mirror, const uint8_t *ram_buffer, const uint8_t *leds) {
+  uint8_t current[MIRROR_WIDTH], delta[MIRROR_WIDTH];
+  uint8_t packet[MIRROR_PACKET_MAX];
+  bool deferred = false;
+
+  mirror->stats.frames++;
+  mirror->stats.frame_bytes = 0;
+  if (--mirror->key_countdown == 0) {
+    mirror->key = MIRROR_ALL_CHANNELS;
+    mirror->key_countdown = MIRROR_KEY_FRAMES;
+  }
+
+  size_t budget = mirror->io.available(mirror->io.ctx);
+  if (budget > MIRROR_FRAME_BUDGET)
+    budget = MIRROR_FRAME_BUDGET;
+
+  uint8_t first = mirror->next;
+  for (uint8_t i = 0; i < MIRROR_CHANNELS; ++i) {
+    uint8_t channel = (first + i) % MIRROR_CHANNELS;
+    uint8_t len = mirror_channel(ram_buffer, leds, channel, current);
+    bool raw = mirror->key & (1u << channel);
+
+    bool changed = false;
+    for (uint8_t k = 0; k < len; ++k) {
+      delta[k] = current[k] ^ mirror->sent[channel][k];
+      changed |= delta[k] != 0;
+    }
+    if (!changed && !raw)
+      continue;
+
+    size_t payload = mirror_packbits(raw ? current : delta, len, &packet[MIRROR_HEADER_SIZE]);
+    size_t size = MIRROR_HEADER_SIZE + payload + 2;
+    if (size > budget) {
+      mirror->stats.deferred++;
+      if (!deferred)
+        mirror->next = channel; // Na próxima vez começa pelo canal adiado
+      deferred = true;
+      continue;
+    }
+
+    packet[0] = MIRROR_SYNC;
+    packet[1] = channel | (raw ? MIRROR_RAW : 0);
+    packet[2] = mirror->seq[channel]++;
+    packet[3] = payload;
+    uint16_t crc = link_crc16(&packet[1], MIRROR_HEADER_SIZE - 1 + payload);
+    packet[size - 2] = crc >> 8;
+    packet[size - 1] = crc;
+
+    mirror->io.write(mirror->io.ctx, packet, size);
+    memcpy(mirror->sent[channel], current, len);
+    mirror->key &= ~(1u << channel);
+    budget -= size;
+
+    mirror->stats.packets++;
+    mirror->stats.bytes += size;
+    mirror->stats.frame_bytes += size;
+  }
+
+  if (mirror->stats.frame_bytes > mirror->stats.frame_bytes_max)
+    mirror->stats.frame_bytes_max = mirror->stats.frame_bytes;
+  return mirror->stats.frame_bytes;
+}
@@ -0,0 +1,62 @@
+#ifndef MIRROR_H
+#define MIRROR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Espelho do OLED e da matriz de LEDs pela USB: a cada quadro envia só as
+// páginas do framebuffer (e o estado dos LEDs) que mudaram desde o último
+// envio, como XOR em relação à cópia enviada comprimido com PackBits. Não
+// depende do SDK do Pico, para o mesmo código servir de referência no host.
+//
+// Pacote:
+//   [0xC3][canal][seq][tamanho][dados PackBits][CRC-16]
+// canal: bits 0-3 = página 0-7 do OLED ou 8 = LEDs; bit 7 = dados brutos
+// (quadro-chave) em vez de XOR. seq conta os pacotes de cada canal; o
+// visualizador só aplica um XOR sobre o pacote anterior do mesmo canal e,
+// se perder algum, espera o próximo quadro-chave daquele canal.
+
+#define MIRROR_SYNC 0xC3
+#define MIRROR_PAGES 8
+#define MIRROR_WIDTH 128
+#define MIRROR_LED_BYTES 75            // 25 LEDs GRB
+#define MIRROR_CHANNELS (MIRROR_PAGES + 1)
+#define MIRROR_CHANNEL_LEDS MIRROR_PAGES
+#define MIRROR_RAW 0x80
+#define MIRROR_HEADER_SIZE 4
+#define MIRROR_PACKET_MAX (MIRROR_HEADER_SIZE + MIRROR_WIDTH + MIRROR_WIDTH / 128 + 2)
+#define MIRROR_KEY_FRAMES 50           // Quadro-chave a cada 1 s a 50 FPS
+#define MIRROR_FRAME_BUDGET 256        // Bytes enviados por quadro, no máximo
+
+// Transporte (CDC da USB no Pico)
+typedef struct {
+  size_t (*available)(void *ctx);      // Espaço livre para escrita sem bloquear
+  void (*write)(void *ctx, const uint8_t *data, size_t len);
+  void *ctx;
+} mirror_transport_t;
+
+typedef struct {
+  uint32_t frames;                     // Chamadas de mirror_update
+  uint32_t packets, bytes;
+  uint32_t deferred;                   // Canais adiados por falta de espaço ou orçamento
+  uint16_t frame_bytes;                // Bytes enviados no último quadro
+  uint16_t frame_bytes_max;
+} mirror_stats_t;
+
+typedef struct {
+  mirror_transport_t io;
+  uint8_t sent[MIRROR_CHANNELS][MIRROR_WIDTH]; // Cópia do que o visualizador tem
+  uint8_t seq[MIRROR_CHANNELS];
+  uint16_t key;                        // Canais pendentes de quadro-chave (um bit por canal)
+  uint8_t key_countdown;
+  uint8_t next;                        // Canal por onde começa a próxima varredura
+  mirror_stats_t stats;
+} mirror_t;
+
+void mirror_init(mirror_t *mirror, const mirror_transport_t *io);
+void mirror_request_key(mirror_t *mirror);
+uint16_t mirror_update(mirror_t *mirror, const uint8_t *ram_buffer, const uint8_t *leds);
+size_t mirror_packbits(const uint8_t *data, size_t len, uint8_t *out);
+
+#endif
@@ -0,0 +1,154 @@
+#include <string.h>
+#include "render.h"
+
+// Renderizador do campo de jogo: a cada quadro apaga a área dos sprites
+// anteriores, desenha os novos direto no ram_buffer e envia, página a página,
+// só as colunas que diferem do que o display já tem: objetos em páginas
+// distantes (nave embaixo, inimigo em cima) não arrastam as páginas entre
+// eles, e um quadro sem mudanças não gera tráfego I2C. As rotinas por quadro
+// ficam na SRAM, como as primitivas do ssd1306.
+
+static inline void __not_in_flash_func(span_extend)(render_span_t *span, uint8_t x0, uint8_t x1) {
+  if (span->empty) {
+    span->x0 = x0;
+    span->x1 = x1;
+    span->empty = false;
+    return;
+  }
+  span->x0 = MIN(span->x0, x0);
+  span->x1 = MAX(span->x1, x1);
+}
+
+void render_init(render_t *r, ssd1306_t *ssd, uint8_t first_page, uint8_t last_page) {
+  r->ssd = ssd;
+  r->first_page = first_page;
+  r->last_page = last_page;
+  r->objects = 0;
+  r->culled = 0;
+  r->frame_us = r->frame_us_max = 0;
+  r->flushes = 0;
+  r->deferred = 0;
+  hard_assert(last_page < RENDER_MAX_PAGES && ssd->width <= WIDTH);
+  for (uint8_t p = 0; p < RENDER_MAX_PAGES; ++p)
+    r->drawn[p].empty = r->dirty[p].empty = true;
+
+  // O campo acabou de ser enviado inteiro (ssd1306_send_data)
+  for (uint8_t p = first_page; p <= last_page; ++p)
+    for (uint8_t x = 0; x < ssd->width; ++x)
+      r->sent[p][x] = ssd->ram_buffer[1 + x * ssd->pages + p];
+}
+
+// Inicia um quadro: apaga do buffer o que foi desenhado no quadro anterior
+// e marca essa área como suja, para que o apagamento também seja enviado
+void __not_in_flash_func(render_begin)(render_t *r) {
+  r->frame_start_us = time_us_32();
+  r->objects = 0;
+  r->culled = 0;
+  for (uint8_t p = r->first_page; p <= r->last_page; ++p) {
+    render_span_t *span = &r->drawn[p];
+    if (span->empty)
+      continue;
+    span_extend(&r->dirty[p], span->x0, span->x1); // Soma-se ao que ficou de um quadro adiado
+    for (uint8_t x = span->x0; x <= span->x1; ++x)
+      r->ssd->ram_buffer[1 + x * r->ssd->pages + p] = 0;
+    span->empty = true;
+  }
+}
+
+// Desenha um sprite com o canto superior esquerdo em (x, y), em pixels da tela.
+// Objetos totalmente fora do campo são descartados e retornam false. O sprite
+// é deslocado (y & 7) bits e escrito em duas páginas por coluna.
+bool __not_in_flash_func(render_sprite)(render_t *r, const sprite_t *sprite, int16_t x, int16_t y) {
+  int16_t top = r->first_page * 8;
+  int16_t bottom = (r->last_page + 1) * 8;
+  if (x >= r->ssd->width || x + sprite->width <= 0 || y >= bottom || y + sprite->height <= top) {
+    r->culled++;
+    return false;
+  }
+
+  int16_t col0 = MAX(x, 0);
+  int16_t col1 = MIN(x + sprite->width, r->ssd->width) - 1;
+  uint8_t shift = y & 7;
+  int16_t base_page = y >> 3;
+  uint8_t sprite_pages = (sprite->height + 7) / 8;
+  uint8_t *buffer = r->ssd->ram_buffer;
+  uint8_t pages = r->ssd->pages;
+
+  int16_t page0 = MAX(base_page, r->first_page);
+  int16_t page1 = MIN(base_page + sprite_pages - (shift ? 0 : 1), r->last_page);
+
+  for (uint8_t sp = 0; sp < sprite_pages; ++sp) {
+    int16_t p = base_page + sp;
+    const uint8_t *image = &sprite->image[sp * sprite->width + (col0 - x)];
+    const uint8_t *mask = &sprite->mask[sp * sprite->width + (col0 - x)];
+    bool upper = p >= r->first_page && p <= r->last_page;
+    bool lower = shift && p + 1 >= r->first_page && p + 1 <= r->last_page;
+
+    for (int16_t col = col0; col <= col1; ++col) {
+      uint16_t bits = *image++ << shift;
+      uint16_t opaque = *mask++ << shift;
+      int16_t index = 1 + col * pages + p;
+      if (upper)
+        buffer[index] = (buffer[index] & ~opaque) | (bits & opaque);
+      if (lower)
+        buffer[index + 1] = (buffer[index + 1] & ~(opaque >> 8)) | ((bits & opaque) >> 8);
+    }
+  }
+
+  for (int16_t p = page0; p <= page1; ++p) {
+    span_extend(&r->drawn[p], col0, col1);
+    span_extend(&r->dirty[p], col0, col1);
+  }
+  r->objects++;
+  return true;
+}
+
+// Fecha o quadro: em cada página suja, estreita a faixa às colunas que
+// diferem de 'sent' e envia só essas, todas em um envio (a rolagem do
+// controlador é pausada uma vez). Sem diferenças, nada é enviado. Se a
+// rolagem ainda não correu o bastante desde a última pausa, o envio fica
+// para o próximo quadro, com as faixas sujas acumuladas.
+void __not_in_flash_func(render_end)(render_t *r) {
+  const uint8_t *buffer = r->ssd->ram_buffer;
+  uint8_t pages = r->ssd->pages;
+  bool any = false;
+
+  if (!ssd1306_area_ready(r->ssd)) {
+    r->deferred++;
+    r->frame_us = time_us_32() - r->frame_start_us;
+    if (r->frame_us > r->frame_us_max)
+      r->frame_us_max = r->frame_us;
+    return;
+  }
+
+  for (uint8_t p = r->first_page; p <= r->last_page; ++p) {
+    render_span_t *span = &r->dirty[p];
+    if (span->empty)
+      continue;
+    span->empty = true;
+
+    int16_t x0 = span->x0, x1 = span->x1;
+    while (x0 <= x1 && buffer[1 + x0 * pages + p] == r->sent[p][x0])
+      x0++;
+    while (x1 >= x0 && buffer[1 + x1 * pages + p] == r->sent[p][x1])
+      x1--;
+    if (x0 > x1)
+      continue;
+
+    for (int16_t x = x0; x <= x1; ++x)
+      r->sent[p][x] = buffer[1 + x * pages + p];
+    if (!any)
+      ssd1306_area_begin(r->ssd);
+    any = true;
+    ssd1306_area_add(r->ssd, x0, x1, p, p);
+  }
+
+  if (any) {
+    ssd1306_area_end(r->ssd);
+    r->flushes++;
+  }
+
+  r->frame_us = time_us_32() - r->frame_start_us;
+  if (r->frame_us > r->frame_us_max)
+    r->frame_us_max = r->frame_us;
+}
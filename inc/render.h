@@ -0,0 +1,43 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "ssd1306.h"
+
+// Sprite 1-bpp com máscara. Cada byte é uma coluna de 8 linhas (bit 0 em cima),
+// no mesmo formato das páginas do SSD1306; sprites com mais de 8 linhas guardam
+// uma faixa de 'width' bytes por página (image[pagina * width + coluna]).
+typedef struct {
+  uint8_t width, height;
+  const uint8_t *image; // Pixels acesos
+  const uint8_t *mask;  // Pixels opacos (apagam o que estiver por baixo)
+} sprite_t;
+
+#define RENDER_MAX_PAGES 8
+
+// Faixa de colunas x0..x1 alterada em uma página
+typedef struct {
+  uint8_t x0, x1;
+  bool empty;
+} render_span_t;
+
+// Campo de jogo desenhado dentro de um intervalo de páginas do framebuffer
+typedef struct {
+  ssd1306_t *ssd;
+  uint8_t first_page, last_page;
+  render_span_t drawn[RENDER_MAX_PAGES]; // Colunas ocupadas pelos sprites do quadro anterior, por página
+  render_span_t dirty[RENDER_MAX_PAGES]; // Colunas que podem ter mudado neste quadro, por página
+  uint8_t sent[RENDER_MAX_PAGES][WIDTH]; // Conteúdo que o display já tem, para enviar só o que mudou
+  uint16_t objects;    // Sprites desenhados no quadro
+  uint16_t culled;     // Objetos descartados no quadro (fora da tela)
+  uint32_t frame_start_us;
+  uint32_t frame_us, frame_us_max; // Desenho + preparo do envio, por quadro
+  uint32_t flushes;    // Quadros que enviaram algo ao display
+  uint32_t deferred;   // Quadros adiados para a rolagem do controlador completar um passo
+} render_t;
+
+void render_init(render_t *r, ssd1306_t *ssd, uint8_t first_page, uint8_t last_page);
+void render_begin(render_t *r);
+bool render_sprite(render_t *r, const sprite_t *sprite, int16_t x, int16_t y);
+void render_end(render_t *r);
+
+#endif
@@ -0,0 +1,552 @@
+// Gerado por host/wav2c.py - não editar
+#include "sounds.h"
+
+static const uint8_t snd_laser_data[] = {
+  0x5d, 0x5d, 0x5d, 0x5d, 0xa2, 0xa2, 0xa2, 0xa2, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0xa2, 0xa3, 0xa3,
+  0xa3, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa3, 0xa3, 0xa3, 0xa3, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xa3,
+  0xa4, 0xa4, 0xa4, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xa4, 0x5b, 0x5b, 0x5b, 0x5b,
+  0x5b, 0xa4, 0xa4, 0xa5, 0xa5, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0xa5, 0xa5, 0xa5, 0xa5, 0x5a, 0x5a,
+  0x5a, 0x5a, 0x5a, 0xa5, 0xa5, 0xa6, 0xa6, 0x59, 0x59, 0x59, 0x59, 0x59, 0xa6, 0xa6, 0xa6, 0xa6,
+  0xa6, 0x59, 0x59, 0x59, 0x59, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7, 0x58, 0x58, 0x58, 0x58, 0xa7, 0xa7,
+  0xa7, 0xa7, 0xa7, 0x58, 0x58, 0x58, 0x58, 0xa7, 0xa7, 0xa7, 0xa8, 0xa8, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0xa8, 0xa8, 0xa8, 0xa8, 0x57, 0x57, 0x57, 0x57, 0x57, 0xa8, 0xa8, 0xa8, 0xa9, 0xa9, 0x56,
+  0x56, 0x56, 0x56, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x56, 0x56, 0x56, 0x56, 0xa9, 0xa9, 0xa9, 0xa9,
+  0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa,
+  0xaa, 0xaa, 0xab, 0xab, 0x54, 0x54, 0x54, 0x54, 0x54, 0xab, 0xab, 0xab, 0xab, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0xab, 0xab, 0xab, 0xac, 0xac, 0x53, 0x53, 0x53, 0x53, 0xac, 0xac, 0xac, 0xac, 0xac,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0xac, 0xac, 0xac, 0xad, 0xad, 0x52, 0x52, 0x52, 0x52, 0xad, 0xad,
+  0xad, 0xad, 0xad, 0x52, 0x52, 0x52, 0x52, 0x52, 0xad, 0xad, 0xad, 0xae, 0xae, 0x51, 0x51, 0x51,
+  0x51, 0x51, 0xae, 0xae, 0xae, 0xae, 0x51, 0x51, 0x51, 0x51, 0x51, 0xae, 0xae, 0xae, 0xaf, 0xaf,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0xaf, 0xaf, 0xaf, 0xaf, 0xaf, 0x50, 0x50, 0x50, 0x50, 0xaf, 0xaf,
+  0xaf, 0xb0, 0xb0, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x4f, 0x4f, 0x4f,
+  0x4f, 0x4f, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb1, 0xb1, 0xb2, 0xb2, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0xb2,
+  0xb2, 0xb2, 0xb2, 0xb2, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0xb3, 0xb3, 0xb4,
+  0xb4, 0xb4, 0x4b, 0x4b, 0x4b, 0x4b, 0x4b, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x4b, 0x4b, 0x4b, 0x4b,
+  0x4b, 0xb4, 0xb5, 0xb5, 0xb5, 0xb5, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0x49, 0x49, 0x49, 0x49, 0x49, 0xb6,
+  0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0x49, 0x49, 0x49, 0x49, 0x49, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0x48, 0x48, 0x48, 0x48, 0x48, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xb8, 0x47, 0x47, 0x47, 0x47, 0x47, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0x47, 0x47,
+  0x47, 0x47, 0x46, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0x46, 0x46, 0x46, 0x46, 0x46, 0xb9, 0xb9, 0xb9,
+  0xb9, 0xb9, 0x46, 0x46, 0x46, 0x46, 0x45, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x45, 0x45, 0x45,
+  0x45, 0x45, 0xba, 0xba, 0xba, 0xba, 0xba, 0x45, 0x45, 0x45, 0x44, 0x44, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0x44, 0x44, 0x44, 0x44, 0x44, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x44, 0x44, 0x43, 0x43,
+  0x43, 0x43, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0x43, 0x43, 0x43, 0x43, 0x43, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xbc, 0x42, 0x42, 0x42, 0x42, 0x42, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x42, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x41, 0x41, 0x41, 0x41, 0x41, 0xbe, 0xbe, 0xbe, 0xbe,
+  0xbe, 0xbe, 0x41, 0x41, 0x41, 0x41, 0x41, 0xbe, 0xbe, 0xbe, 0xbe, 0xbf, 0xbf, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xbf, 0xbf, 0xbf,
+  0xc0, 0xc0, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0xc1, 0xc1,
+  0xc1, 0xc1, 0xc1, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x3b, 0x3b, 0x3b, 0x3b,
+  0x3b, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0x3b, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0xc5, 0xc5, 0xc5,
+  0xc5, 0xc5, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xc6,
+  0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8, 0x37, 0x37, 0x37, 0x37,
+  0x37, 0x37, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xc9, 0xc9,
+  0xc9, 0xc9, 0xc9, 0xc9, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
+  0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0xcb, 0xcb,
+  0xcb, 0xcb, 0xcb, 0xcb, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xcd, 0xcd, 0xcd, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xcd,
+  0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xcd, 0xcd, 0xce, 0xce, 0xce,
+  0xce, 0xce, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x30, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0x30, 0x30, 0x30, 0x2f, 0x2f, 0x2f, 0x2f, 0xd0, 0xd0,
+  0xd0, 0xd0, 0xd0, 0xd0, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0,
+  0xd0, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd2, 0xd2, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xd2, 0xd3,
+  0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3,
+  0xd3, 0xd3, 0x2c, 0x2c, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0x2b, 0x2a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+  0x2a, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xd6, 0xd6,
+  0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xd6, 0xd7, 0xd7, 0xd7,
+  0xd7, 0xd7, 0xd7, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7,
+  0xd7, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x27, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x27,
+  0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x27, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0x26, 0x26, 0x26, 0x26, 0x26,
+  0x26, 0x26, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xdb,
+  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xdb, 0xdb, 0xdb,
+  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x24, 0x24, 0x24, 0x23, 0x23, 0x23, 0x23, 0xdc, 0xdc, 0xdc, 0xdc,
+  0xdc, 0xdc, 0xdc, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
+  0xdc, 0xdd, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x20, 0x20, 0x20, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1f, 0x1f, 0x1f,
+  0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x1e, 0x1e, 0x1e,
+  0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x1e, 0x1e, 0x1e,
+  0x1e, 0x1e, 0x1e, 0x1d, 0x1d, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0x1d, 0x1c, 0x1c,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x1c, 0x1c, 0x1c,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0x1b, 0x1b,
+  0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0x1b,
+  0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0x1a,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+  0xe6, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7,
+  0xe7, 0xe7, 0xe7, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xe7, 0xe7, 0xe7, 0xe7,
+  0xe7, 0xe7, 0xe7, 0xe7, 0x18, 0x18, 0x18, 0x18, 0x17, 0x17, 0x17, 0x17, 0x17, 0xe8, 0xe8, 0xe8,
+  0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0xe8,
+  0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe9, 0xe9, 0xe9, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0xea, 0x15,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb,
+  0xeb, 0xeb, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xeb, 0xeb, 0xec, 0xec,
+  0xec, 0xec, 0xec, 0xec, 0xec, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0xec,
+  0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xed, 0xed, 0xed, 0xed, 0xed, 0xed, 0xee, 0xee, 0xee, 0xee,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0xef,
+  0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xf0, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+  0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xf1, 0xf1,
+  0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0x0e,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2,
+  0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0xf2, 0xf2, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+  0xf3, 0xf3, 0xf3, 0x0c, 0x0c, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xf4,
+  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5,
+  0xf5, 0xf5, 0xf5, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0xf5,
+  0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6,
+  0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf7, 0xf7, 0xf7, 0xf7,
+  0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+  0xf8, 0xf8, 0xf8, 0xf8, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
+  0xf9, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf9,
+  0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfa, 0xfa, 0xfa, 0xfa,
+  0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa,
+  0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
+  0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+};
+
+const audio_sample_t snd_laser = {AUDIO_PCM8, 2560, snd_laser_data};
+
+static const uint8_t snd_explosion_data[] = {
+  0xf0, 0xff, 0xff, 0xef, 0x0d, 0xbc, 0x72, 0x9a, 0x54, 0x90, 0xc5, 0xa2, 0xab, 0x68, 0x1a, 0x92,
+  0xe1, 0x8b, 0x04, 0x29, 0x90, 0x16, 0x1b, 0x50, 0xc1, 0xc4, 0x28, 0x0c, 0x2b, 0x04, 0xc3, 0x01,
+  0xa0, 0x44, 0x0a, 0x0f, 0x31, 0xb0, 0x1a, 0x0f, 0x8a, 0x28, 0x8a, 0x70, 0x0a, 0x31, 0x22, 0x9c,
+  0x49, 0xc2, 0xab, 0x29, 0xa2, 0x0c, 0x30, 0x17, 0x08, 0xe1, 0x12, 0x01, 0xa9, 0x1d, 0xab, 0x08,
+  0x88, 0x80, 0x08, 0x38, 0xb6, 0x09, 0xa0, 0x77, 0x88, 0x9b, 0x88, 0xa5, 0x49, 0xa0, 0xb1, 0x61,
+  0x02, 0x9b, 0x3a, 0x30, 0xcb, 0x44, 0x00, 0x00, 0x9b, 0xfb, 0x0a, 0x38, 0x85, 0x13, 0x80, 0xad,
+  0xaa, 0x53, 0x92, 0x20, 0x0e, 0x03, 0x90, 0x2d, 0x2a, 0xb3, 0x49, 0xd0, 0xab, 0x15, 0x2a, 0x03,
+  0x8b, 0xae, 0x04, 0x30, 0x2a, 0xd1, 0x9a, 0x19, 0x09, 0x6c, 0x88, 0x31, 0x39, 0x89, 0xf9, 0x98,
+  0x3a, 0x1a, 0x14, 0x1a, 0x40, 0x0d, 0x99, 0x04, 0x20, 0xa4, 0x90, 0x29, 0x8a, 0x79, 0x11, 0xb0,
+  0x48, 0xe0, 0x0c, 0x8b, 0x29, 0x44, 0x1b, 0xc1, 0x43, 0x2b, 0x99, 0x14, 0x8d, 0x98, 0x8a, 0xd3,
+  0x01, 0x0c, 0x12, 0x7b, 0x21, 0xab, 0x3b, 0xa9, 0x70, 0x91, 0x4b, 0x00, 0xbb, 0x83, 0x5c, 0x11,
+  0x3c, 0x2c, 0x98, 0x40, 0xba, 0xa1, 0x9a, 0x08, 0x88, 0x97, 0xa1, 0xa0, 0x80, 0x42, 0x2b, 0xa7,
+  0x84, 0x38, 0x0a, 0x61, 0x1a, 0x80, 0xba, 0xae, 0x39, 0x99, 0x69, 0x13, 0xba, 0x19, 0x1b, 0x79,
+  0x85, 0x3a, 0x9a, 0x8c, 0x01, 0x19, 0x8d, 0x80, 0x08, 0x88, 0x41, 0x15, 0x42, 0xba, 0xb6, 0x01,
+  0x2c, 0x83, 0x20, 0x8f, 0x10, 0x11, 0x18, 0x80, 0xce, 0x89, 0x49, 0x10, 0x01, 0xe8, 0x12, 0x08,
+  0xd0, 0xa2, 0x9a, 0xa4, 0x53, 0x98, 0x18, 0x82, 0xf0, 0x8a, 0x82, 0xc1, 0x0a, 0x33, 0xb2, 0x81,
+  0xe8, 0xa5, 0x24, 0x8c, 0x22, 0xa9, 0x5b, 0x0a, 0x1b, 0xb5, 0x83, 0x12, 0x3d, 0xd9, 0x1b, 0x80,
+  0x0a, 0x68, 0x3b, 0xb3, 0x05, 0xb2, 0x99, 0x05, 0x9a, 0xca, 0x5a, 0x38, 0x9a, 0xb1, 0x70, 0x12,
+  0x28, 0x80, 0xf0, 0x90, 0x01, 0xca, 0xb3, 0x80, 0x49, 0xa4, 0xa1, 0x90, 0xac, 0x79, 0x90, 0x43,
+  0xb9, 0xba, 0xb0, 0x80, 0x64, 0x81, 0x88, 0x98, 0x9c, 0x97, 0x10, 0xa2, 0x9a, 0x00, 0x26, 0xd1,
+  0x1a, 0x93, 0xc0, 0x48, 0x21, 0xc1, 0xab, 0x20, 0x05, 0x00, 0x99, 0x2e, 0x3a, 0xa0, 0x9c, 0x22,
+  0xbc, 0x22, 0xb8, 0xd4, 0x18, 0x16, 0x81, 0x9b, 0x14, 0xda, 0x20, 0x99, 0x42, 0xda, 0x08, 0x92,
+  0x23, 0xc8, 0x95, 0xa1, 0x4b, 0x5a, 0xb8, 0x89, 0x52, 0x8b, 0x6a, 0xaa, 0x09, 0x25, 0x20, 0xa1,
+  0x2c, 0xd1, 0x80, 0x89, 0xba, 0x08, 0x97, 0xa4, 0x38, 0x91, 0x8b, 0x68, 0x8a, 0xc3, 0x38, 0xd2,
+  0xaa, 0x95, 0x22, 0x99, 0x03, 0x2b, 0xba, 0x3e, 0x04, 0xe3, 0x09, 0x23, 0xaa, 0x09, 0xb4, 0x22,
+  0x12, 0xd9, 0xaa, 0xd4, 0x3a, 0xc9, 0x2a, 0x70, 0x21, 0xba, 0x1a, 0x82, 0x0a, 0x22, 0x34, 0xf0,
+  0xa1, 0x90, 0xc3, 0x9a, 0x7b, 0x80, 0x48, 0xa8, 0x03, 0xd4, 0x28, 0x11, 0x9d, 0x9a, 0x05, 0xa2,
+  0x92, 0x2a, 0xd3, 0x00, 0x8b, 0xab, 0x49, 0xb3, 0x0d, 0xa3, 0x98, 0x17, 0xab, 0x11, 0xc3, 0x49,
+  0x98, 0x78, 0x08, 0x09, 0x43, 0xba, 0xc2, 0x5b, 0x28, 0x39, 0xc9, 0x1b, 0x42, 0x1c, 0x09, 0x8b,
+  0x71, 0x0a, 0x32, 0xcb, 0x24, 0xc9, 0x93, 0x02, 0xd1, 0xa1, 0x39, 0xe3, 0x89, 0x90, 0x9a, 0x54,
+  0x0b, 0xc2, 0xb3, 0x11, 0xa1, 0x18, 0x39, 0x98, 0x0f, 0xb1, 0x35, 0xc9, 0xc0, 0x09, 0x1a, 0xd3,
+  0xa3, 0x44, 0xb8, 0x80, 0xa7, 0x32, 0x10, 0x2d, 0x18, 0xd2, 0x20, 0x8d, 0xa0, 0xa3, 0xb2, 0x58,
+  0x9b, 0x90, 0xab, 0x79, 0x32, 0x2b, 0x1c, 0x80, 0x03, 0x58, 0x3d, 0x98, 0xb1, 0x85, 0x1a, 0xc9,
+  0xc2, 0x92, 0x51, 0x08, 0xda, 0x9a, 0x02, 0x51, 0x9b, 0xb2, 0x1c, 0x1a, 0x48, 0xa2, 0x13, 0x7c,
+  0xa9, 0x29, 0x14, 0xa8, 0x2c, 0x80, 0x82, 0x15, 0x3b, 0x0e, 0xa8, 0x3a, 0x1b, 0xa7, 0x29, 0x10,
+  0xb2, 0x9a, 0x5d, 0x12, 0x2c, 0x91, 0x81, 0xcb, 0xb9, 0x50, 0x32, 0xb1, 0x90, 0x84, 0x1c, 0xb5,
+  0xe3, 0x89, 0x32, 0xa1, 0xb3, 0x4c, 0x00, 0x31, 0x2a, 0x28, 0x0d, 0xc9, 0x1c, 0x3d, 0xca, 0x59,
+  0x98, 0xaa, 0x14, 0x22, 0x1c, 0x28, 0x33, 0x1f, 0x12, 0xac, 0xaa, 0x33, 0x21, 0xc0, 0xbc, 0xa4,
+  0x08, 0x8c, 0x40, 0x88, 0x06, 0x01, 0x8c, 0x20, 0x19, 0xc0, 0xb4, 0xb2, 0x9c, 0x44, 0x0b, 0x30,
+  0x0b, 0x49, 0x5a, 0xaa, 0x02, 0x1c, 0x4b, 0x22, 0xa0, 0x9a, 0xc7, 0xc3, 0x89, 0x03, 0x38, 0x0b,
+  0x30, 0x03, 0xbc, 0x4e, 0x20, 0x8c, 0x02, 0x8c, 0xa4, 0x9a, 0x43, 0xbb, 0x89, 0xb2, 0xa8, 0x57,
+  0x3a, 0x8b, 0x15, 0x90, 0x0a, 0x9c, 0xb8, 0x51, 0x82, 0x81, 0x1c, 0x38, 0x95, 0x10, 0xca, 0x42,
+  0x01, 0x82, 0xc8, 0x1c, 0x8e, 0x12, 0xb0, 0x88, 0x91, 0x73, 0x0b, 0xa2, 0x58, 0x0d, 0x2a, 0x83,
+  0x0c, 0x10, 0x18, 0x93, 0x7b, 0x1b, 0x2a, 0x4d, 0xc9, 0x88, 0x0a, 0x31, 0x99, 0x5a, 0x85, 0x3a,
+  0xb9, 0x5b, 0x12, 0x09, 0x5c, 0x09, 0x12, 0xb9, 0xd8, 0x93, 0xb3, 0xaa, 0xb8, 0x3f, 0x98, 0x28,
+  0x40, 0x92, 0x17, 0x2c, 0x12, 0x1d, 0xc0, 0x3a, 0x90, 0xab, 0x59, 0xa8, 0x25, 0x3a, 0x28, 0x30,
+  0x11, 0x0f, 0x19, 0x3a, 0xc9, 0xbb, 0xc0, 0xb1, 0x22, 0x72, 0x3c, 0x08, 0x31, 0xaa, 0xc6, 0x10,
+  0x1c, 0x21, 0x4a, 0x89, 0xe2, 0x01, 0x29, 0x8a, 0x38, 0x8d, 0x18, 0xb3, 0xa4, 0xc0, 0x60, 0x10,
+  0xaa, 0x1a, 0x31, 0x1f, 0x82, 0x9c, 0x9b, 0x06, 0x11, 0x83, 0x88, 0x91, 0xd0, 0x80, 0xe2, 0xba,
+  0x34, 0x90, 0x13, 0xc8, 0x9a, 0x89, 0x73, 0x1c, 0xab, 0x04, 0x94, 0x8b, 0x41, 0x93, 0xd9, 0xa1,
+  0xba, 0x5b, 0x59, 0x39, 0xab, 0x93, 0xa3, 0x4c, 0x42, 0xc1, 0x10, 0x38, 0x4b, 0xe0, 0x1a, 0xb2,
+  0x29, 0x4a, 0xd0, 0x18, 0x20, 0x4b, 0x19, 0x91, 0x49, 0x15, 0xb9, 0x3d, 0x21, 0x0b, 0x14, 0xd8,
+  0x39, 0x0a, 0x30, 0xe2, 0x9d, 0x18, 0x32, 0x2d, 0x21, 0xb9, 0x23, 0x38, 0xed, 0x10, 0x1a, 0xc3,
+  0x10, 0xb9, 0x4b, 0x93, 0x2e, 0xb2, 0x41, 0x92, 0x89, 0xbd, 0x3a, 0x18, 0x08, 0xcd, 0x87, 0x19,
+  0xa1, 0x81, 0xc0, 0x6a, 0x01, 0x98, 0x82, 0x13, 0x22, 0xdd, 0x9a, 0x9a, 0x52, 0x48, 0xb1, 0x80,
+  0x5b, 0x1a, 0x40, 0xa0, 0xc8, 0x24, 0xcb, 0x88, 0x33, 0xe2, 0x11, 0x38, 0xad, 0x31, 0xb0, 0x20,
+  0x8e, 0x9a, 0x90, 0xa9, 0xb5, 0x94, 0x6a, 0x39, 0x22, 0x9b, 0x5b, 0x01, 0x99, 0x82, 0xe0, 0xb9,
+  0x13, 0x4c, 0x89, 0x8a, 0x95, 0x09, 0x58, 0x4a, 0x3b, 0xb1, 0xa0, 0xaa, 0x78, 0x15, 0x9b, 0xc3,
+  0x91, 0xb4, 0x91, 0xca, 0x04, 0x0a, 0x94, 0xa0, 0x4a, 0xa1, 0xbb, 0x14, 0xa9, 0x53, 0x03, 0xbc,
+  0x83, 0xe3, 0x93, 0x33, 0xf9, 0x82, 0xa2, 0x4b, 0xb9, 0x18, 0x1d, 0x00, 0x3a, 0x35, 0x2b, 0x3a,
+  0x2f, 0x93, 0x98, 0xf0, 0xa3, 0xaa, 0x48, 0x9b, 0xa3, 0x4b, 0x12, 0xd3, 0x14, 0x9c, 0x00, 0xb8,
+  0xa1, 0x73, 0x1a, 0xb2, 0x34, 0x8a, 0x93, 0x6a, 0xb1, 0x9b, 0x68, 0x21, 0x01, 0x8e, 0x12, 0x9b,
+  0xa0, 0xd8, 0x08, 0x9c, 0x25, 0x02, 0x21, 0xf2, 0x98, 0x90, 0x48, 0xa8, 0x90, 0xa4, 0x2a, 0x1d,
+  0x84, 0x8a, 0xb0, 0xbb, 0x00, 0x98, 0x5c, 0x15, 0x20, 0x2b, 0x08, 0x81, 0xcb, 0x1b, 0x48, 0x8f,
+  0x95, 0x00, 0x59, 0x29, 0xbb, 0x84, 0x0b, 0x30, 0x9c, 0x16, 0x8a, 0x18, 0x41, 0x92, 0x11, 0xa1,
+  0x02, 0xf5, 0xc1, 0x81, 0x38, 0xa8, 0x22, 0xc8, 0x99, 0xc2, 0x09, 0xa9, 0x45, 0x99, 0xab, 0x2c,
+  0xd2, 0x95, 0x23, 0xc2, 0x28, 0xbd, 0x01, 0x14, 0x38, 0x98, 0xb0, 0x0a, 0x7b, 0x91, 0x9c, 0x18,
+  0x50, 0x93, 0x0a, 0xa5, 0x29, 0x9d, 0x14, 0xc9, 0x03, 0x31, 0xb1, 0xae, 0x80, 0xab, 0x12, 0x79,
+  0xc1, 0x28, 0x19, 0x8d, 0x03, 0xb1, 0x00, 0x3a, 0x70, 0x90, 0xac, 0xb2, 0xaa, 0x63, 0x21, 0xbc,
+  0x93, 0x93, 0x9b, 0x7c, 0x80, 0x80, 0x4b, 0x31, 0x08, 0xeb, 0x33, 0x3a, 0xb1, 0x50, 0x29, 0x9c,
+  0xc1, 0x4a, 0x28, 0xcb, 0xa8, 0x96, 0xa0, 0x81, 0xc8, 0x49, 0x88, 0x8a, 0xc8, 0x04, 0x49, 0x9a,
+  0x96, 0x30, 0xb2, 0x39, 0x69, 0x3a, 0xb8, 0xc8, 0x92, 0x05, 0xa9, 0xb1, 0xb5, 0x10, 0x4a, 0x29,
+  0xa0, 0xf9, 0x49, 0x18, 0x1b, 0x18, 0xca, 0x98, 0x6a, 0x08, 0x25, 0x13, 0xac, 0x2b, 0xa2, 0x28,
+  0xc3, 0x94, 0xc0, 0x5c, 0x11, 0xbc, 0x89, 0x08, 0x0a, 0xa4, 0x16, 0x91, 0x28, 0xd9, 0x23, 0xca,
+  0x04, 0x9b, 0x4a, 0x49, 0xb2, 0x81, 0x42, 0xcb, 0x84, 0x03, 0x11, 0xa8, 0x0f, 0x88, 0xc3, 0xd2,
+  0x21, 0x0a, 0x04, 0xa9, 0x8d, 0xa0, 0xa8, 0x24, 0x9a, 0x01, 0x87, 0x39, 0x1b, 0x4a, 0x20, 0x1c,
+  0x91, 0x33, 0xaf, 0xa8, 0x8b, 0x59, 0xa0, 0x18, 0xa8, 0xbc, 0x47, 0x2a, 0x03, 0x0b, 0xb8, 0xd1,
+  0x15, 0x20, 0xa0, 0xbb, 0x4c, 0xa3, 0x2a, 0x34, 0x2c, 0x12, 0xdb, 0xa2, 0x09, 0x59, 0xcb, 0x11,
+  0x14, 0x23, 0xa9, 0x9e, 0xc0, 0xb2, 0x60, 0xba, 0x90, 0xb3, 0x25, 0x92, 0x2a, 0x98, 0x89, 0x53,
+  0xc4, 0x8a, 0x90, 0xcb, 0x18, 0x37, 0x31, 0x92, 0xf0, 0x80, 0x89, 0x93, 0xb0, 0x5a, 0x9d, 0x01,
+  0x2b, 0x29, 0x08, 0x91, 0xad, 0x06, 0x3a, 0xba, 0x91, 0x21, 0x3b, 0x1e, 0xc2, 0xc0, 0x51, 0x11,
+  0xc2, 0x14, 0x2c, 0xa9, 0x84, 0xb1, 0xd2, 0x89, 0x2b, 0x89, 0x84, 0x15, 0x82, 0x23, 0x1e, 0x1a,
+  0x20, 0x9d, 0x31, 0xf1, 0xa0, 0x20, 0x3b, 0xb1, 0x0b, 0x04, 0xcc, 0x4a, 0x19, 0x39, 0xb8, 0x06,
+  0x21, 0xe3, 0x99, 0x30, 0xd2, 0x3a, 0x91, 0xb8, 0x95, 0x03, 0x8d, 0x4a, 0xb0, 0x8a, 0x21, 0x98,
+  0x2e, 0xb8, 0x71, 0x9a, 0x82, 0x08, 0x28, 0x71, 0xc3, 0x10, 0x02, 0x80, 0xba, 0x33, 0x04, 0x1d,
+  0x90, 0xb8, 0xb8, 0x9f, 0x69, 0x88, 0xa9, 0xa8, 0x7b, 0x80, 0x91, 0xa9, 0x08, 0x14, 0x95, 0x03,
+  0xac, 0x51, 0x19, 0x28, 0x8c, 0xa3, 0xda, 0x89, 0xa3, 0xa0, 0x73, 0xa1, 0x32, 0xd0, 0x22, 0xca,
+  0x1a, 0x04, 0xc3, 0x29, 0x90, 0xa1, 0x0f, 0x2b, 0x19, 0xa2, 0xe0, 0x14, 0xc3, 0x11, 0xc9, 0xa9,
+  0xa4, 0x83, 0x11, 0x20, 0xb1, 0xc4, 0x32, 0xc2, 0x53, 0xba, 0x48, 0xbd, 0x10, 0x92, 0xa5, 0xc1,
+  0xab, 0x2b, 0xa2, 0x07, 0x9a, 0x43, 0xba, 0xa3, 0x87, 0x91, 0x92, 0x39, 0x2c, 0x1c, 0x38, 0x0d,
+  0x48, 0x02, 0xab, 0x8a, 0xba, 0x16, 0x59, 0x1a, 0x4b, 0xa2, 0x31, 0x9c, 0x48, 0x1c, 0x80, 0x30,
+  0x3c, 0x3a, 0xf3, 0x22, 0xea, 0x29, 0x3b, 0x2a, 0x9c, 0xb2, 0x68, 0x21, 0xd3, 0x19, 0xc1, 0xa0,
+  0xa0, 0x6b, 0x28, 0x0a, 0x0a, 0x4a, 0x3a, 0xb0, 0x18, 0x87, 0x5a, 0x02, 0xaa, 0xba, 0x1c, 0x11,
+  0xc8, 0x33, 0x11, 0x73, 0x12, 0xba, 0x59, 0x9a, 0xc9, 0xb5, 0x40, 0x1a, 0xa9, 0xba, 0x35, 0xd3,
+  0x91, 0x01, 0x5a, 0x1c, 0x82, 0x30, 0x0b, 0xa1, 0xa1, 0x08, 0xd2, 0x81, 0x1e, 0x6b, 0x18, 0x98,
+  0xbb, 0x86, 0x00, 0xb2, 0x3c, 0x18, 0x34, 0xf2, 0x19, 0xc2, 0x9a, 0x8a, 0x04, 0xb8, 0x60, 0x81,
+  0x28, 0xc1, 0x91, 0xb0, 0x99, 0xf8, 0x29, 0x8b, 0x84, 0x98, 0xa6, 0x32, 0x0a, 0x13, 0xf9, 0x80,
+  0x92, 0x28, 0x94, 0x19, 0xb5, 0x14, 0x1a, 0xdb, 0x92, 0x00, 0x24, 0x0e, 0x88, 0x93, 0x38, 0x89,
+  0x48, 0x20, 0xfb, 0x00, 0x21, 0xad, 0x3b, 0xcb, 0x04, 0x3b, 0x02, 0x2d, 0x18, 0x16, 0xc2, 0x89,
+  0x4b, 0xa9, 0xa8, 0x05, 0x80, 0x9c, 0x24, 0xb3, 0xcb, 0x81, 0x00, 0x92, 0xb5, 0x05, 0x9c, 0x81,
+  0x91, 0x5a, 0x29, 0x03, 0x59, 0x39, 0x8e, 0xb0, 0xc3, 0xa0, 0x05, 0x81, 0x01, 0xca, 0xc3, 0xa4,
+  0xab, 0x53, 0x08, 0x39, 0xc1, 0x1c, 0x4b, 0xa9, 0x92, 0xb1, 0x97, 0xb3, 0x43, 0xd9, 0x18, 0x09,
+  0x0b, 0x83, 0xd3, 0xb3, 0x35, 0x93, 0xab, 0x92, 0xc6, 0x28, 0x80, 0xad, 0x49, 0xa2, 0xc3, 0x40,
+  0x29, 0xd0, 0x88, 0x2a, 0x3a, 0xca, 0xb1, 0x42, 0x01, 0x0e, 0x2a, 0x1a, 0x08, 0xc3, 0x7a, 0x38,
+  0x82, 0xcb, 0xb3, 0x10, 0x0c, 0x1a, 0x92, 0x0b, 0xdb, 0x79, 0x42, 0x3b, 0x20, 0x10, 0x2c, 0xac,
+  0x0c, 0x91, 0xb5, 0xa2, 0x32, 0xe3, 0x19, 0xb4, 0x11, 0xa3, 0x93, 0xe5, 0x82, 0xb9, 0x3a, 0xc2,
+  0xa9, 0x9a, 0x78, 0x15, 0x88, 0x21, 0x80, 0x0b, 0x22, 0x0f, 0xb9, 0x04, 0xc1, 0x22, 0x02, 0x11,
+  0xc9, 0x02, 0xe2, 0x92, 0xe2, 0x02, 0x1b, 0xcb, 0xa8, 0x58, 0x10, 0x29, 0x11, 0x23, 0xfc, 0x10,
+  0x0a, 0x12, 0x8f, 0xaa, 0x02, 0x00, 0xb9, 0x68, 0xa1, 0x9b, 0x03, 0x43, 0x2c, 0x2d, 0x9a, 0x96,
+  0x39, 0x30, 0x89, 0x94, 0xc4, 0xb2, 0xd8, 0x39, 0x28, 0x9a, 0x1b, 0x05, 0x49, 0x03, 0x0e, 0x38,
+  0x1a, 0xa0, 0x18, 0x95, 0x5a, 0x1c, 0x00, 0x19, 0x03, 0xf1, 0xba, 0x24, 0x0b, 0xd0, 0x28, 0x90,
+  0xa2, 0x80, 0x06, 0x02, 0x4a, 0x00, 0xcc, 0x20, 0xa1, 0x0d, 0xc3, 0xb2, 0xba, 0x09, 0x37, 0x9a,
+  0xa4, 0x89, 0x9b, 0x00, 0x97, 0x49, 0x28, 0x11, 0xca, 0x82, 0x10, 0xb2, 0x7b, 0xa8, 0xb1, 0xe3,
+  0x02, 0x49, 0xaa, 0x1b, 0x23, 0x49, 0x9d, 0x42, 0x10, 0xa1, 0x14, 0xab, 0xb2, 0x3e, 0x88, 0x41,
+  0x9d, 0x0c, 0x20, 0x82, 0x19, 0x4c, 0x22, 0x0d, 0x92, 0x23, 0x11, 0x28, 0x8f, 0x80, 0xcc, 0x20,
+  0xba, 0xca, 0x62, 0x81, 0xb0, 0xa3, 0x1d, 0x9a, 0x1b, 0x52, 0x4b, 0x9b, 0x93, 0x28, 0x6b, 0x4a,
+  0x02, 0x2c, 0x0c, 0xa8, 0x31, 0x81, 0x10, 0x5c, 0x15, 0xb2, 0xd3, 0xa9, 0x18, 0x81, 0xca, 0x98,
+  0x5b, 0x80, 0x3a, 0xab, 0x52, 0x16, 0x23, 0x00, 0xaf, 0x2a, 0x01, 0x9a, 0x1b, 0x97, 0x9b, 0x48,
+  0x82, 0xbb, 0x4a, 0x60, 0x12, 0x19, 0xcb, 0x00, 0x9b, 0x4c, 0x32, 0x94, 0xa1, 0x22, 0xbe, 0x1a,
+  0xc9, 0x33, 0xc8, 0x84, 0x8b, 0x51, 0x18, 0xab, 0x95, 0x0a, 0xaa, 0x20, 0x43, 0xe8, 0xb2, 0x80,
+  0x33, 0x2b, 0x84, 0x4e, 0xc0, 0x49, 0x89, 0x22, 0x10, 0xbd, 0x24, 0xac, 0x39, 0x19, 0x05, 0xa2,
+  0xdb, 0xa2, 0x14, 0x3b, 0x0b, 0x3c, 0x43, 0x2d, 0x28, 0x09, 0x20, 0xbe, 0x90, 0xc8, 0xc3, 0x33,
+  0xb8, 0xb2, 0xc8, 0x07, 0xa8, 0x31, 0xc3, 0x99, 0xc3, 0x51, 0xc1, 0xaa, 0x12, 0x00, 0x18, 0x52,
+  0x21, 0x23, 0xf0, 0x29, 0x29, 0x2d, 0x19, 0x9c, 0xa9, 0x0b, 0x16, 0x22, 0x31, 0xe1, 0x9a, 0xac,
+  0x24, 0x19, 0x31, 0x91, 0x1f, 0x09, 0x89, 0xb4, 0x18, 0x48, 0x4a, 0x20, 0xbd, 0x39, 0x9d, 0x32,
+  0x8b, 0x12, 0x22, 0xbd, 0x2d, 0x9a, 0x15, 0x00, 0x10, 0xea, 0xba, 0x90, 0x2a, 0x17, 0x18, 0xb9,
+  0x08, 0x03, 0xd3, 0x95, 0xc3, 0x92, 0x22, 0xb1, 0x9e, 0xa3, 0x11, 0xb1, 0xbc, 0x87, 0x01, 0xba,
+  0x5b, 0x49, 0x18, 0x2a, 0x99, 0xc1, 0x49, 0x89, 0xa4, 0x9a, 0x08, 0x13, 0xb7, 0x32, 0xda, 0xb0,
+  0x31, 0xac, 0xa1, 0x18, 0xcb, 0x21, 0x37, 0x9b, 0x14, 0x53, 0xc2, 0x82, 0xba, 0xa4, 0x8c, 0x03,
+  0xd2, 0x90, 0x29, 0xb9, 0x07, 0xaa, 0x02, 0x0b, 0x04, 0x09, 0x22, 0x4d, 0x23, 0xa2, 0xe3, 0x0a,
+  0xd3, 0xb9, 0xb0, 0x49, 0x51, 0x18, 0x3c, 0x89, 0x40, 0x48, 0xb0, 0xc2, 0x94, 0x3a, 0x9a, 0x2a,
+  0x8e, 0x3a, 0x1c, 0x09, 0x31, 0x9c, 0x7b, 0xa9, 0x11, 0xb4, 0x99, 0x02, 0x68, 0x31, 0xb3, 0xa4,
+  0x3c, 0xbc, 0x99, 0x35, 0x09, 0x22, 0x80, 0xae, 0x01, 0x33, 0xc4, 0x2c, 0xb0, 0xb1, 0x9a, 0x31,
+  0x2f, 0x81, 0x31, 0x8e, 0x11, 0xb1, 0x24, 0x9b, 0xb5, 0x49, 0xb2, 0xb2, 0x21, 0xae, 0x9a, 0xac,
+  0x10, 0x3b, 0x17, 0x18, 0xa8, 0xd0, 0xa2, 0x60, 0x21, 0x00, 0x31, 0x1d, 0xaa, 0x02, 0x33, 0xf8,
+  0x0c, 0x91, 0xcb, 0x39, 0x9b, 0x48, 0xa6, 0x39, 0xa3, 0x19, 0x89, 0xa0, 0xbd, 0xa9, 0x44, 0x59,
+  0x81, 0xa0, 0x05, 0xab, 0x82, 0xa3, 0x34, 0x1d, 0x3b, 0x23, 0xcc, 0x11, 0xac, 0xc2, 0x92, 0x1a,
+  0x41, 0x3c, 0x9a, 0x42, 0x61, 0x9a, 0xa1, 0xab, 0x35, 0x42, 0xa1, 0x2b, 0x0e, 0xbb, 0xb1, 0x36,
+  0xa8, 0x0b, 0x81, 0x03, 0xc5, 0x8b, 0x90, 0xb3, 0x18, 0x45, 0x89, 0x36, 0xc8, 0x18, 0xca, 0x24,
+  0x0b, 0xa0, 0x3c, 0x82, 0x8d, 0x5a, 0x9a, 0xb3, 0xba, 0x29, 0x97, 0x39, 0x80, 0x9b, 0x97, 0x28,
+  0x43, 0x38, 0xa8, 0x29, 0xf2, 0x39, 0x2c, 0x99, 0x0a, 0xa5, 0xa3, 0x2a, 0xb9, 0x68, 0x03, 0x1d,
+  0x21, 0xa4, 0x12, 0x9c, 0xa9, 0xc9, 0x5a, 0x18, 0x23, 0x4b, 0x42, 0x00, 0xd1, 0xa0, 0xd1, 0x98,
+  0xa2, 0x33, 0xf3, 0x02, 0x00, 0x1e, 0x88, 0x2a, 0x21, 0xac, 0xda, 0xb8, 0xa3, 0xbb, 0x95, 0x81,
+  0x45, 0x19, 0x83, 0x13, 0x3b, 0xf8, 0x20, 0x89, 0x39, 0xd1, 0x9a, 0x15, 0x3c, 0x0c, 0x18, 0xc8,
+  0x30, 0xa2, 0x3b, 0xc4, 0x53, 0xa9, 0x31, 0xac, 0x2a, 0x0b, 0x38, 0x4f, 0x02, 0xc1, 0x82, 0x21,
+  0x3a, 0xce, 0x20, 0x22, 0x39, 0xe9, 0x10, 0x89, 0xab, 0x09, 0xe8, 0x8c, 0x23, 0x9a, 0xb1, 0x72,
+  0x09, 0x22, 0x21, 0x3c, 0xd4, 0x92, 0xcb, 0x12, 0x0b, 0x51, 0x29, 0xbb, 0x8b, 0xa2, 0xac, 0x9c,
+  0x28, 0x3a, 0x71, 0x63, 0xa8, 0xb1, 0xba, 0x54, 0x88, 0x98, 0x82, 0x5b, 0xd1, 0x13, 0x19, 0x93,
+  0xb9, 0x21, 0x63, 0x9c, 0x22, 0x00, 0x5b, 0xa8, 0xcc, 0x23, 0x9d, 0x00, 0x49, 0x09, 0x04, 0xa8,
+  0x09, 0xb4, 0x9a, 0x79, 0xa0, 0x39, 0x2c, 0xac, 0x4b, 0x99, 0x8b, 0x34, 0x35, 0x30, 0x3d, 0xb9,
+  0x32, 0xda, 0x22, 0x30, 0xbe, 0xba, 0x22, 0x9c, 0x3a, 0x72, 0x38, 0x89, 0xaa, 0x35, 0xb1, 0xac,
+  0x28, 0x1c, 0xd2, 0x30, 0x80, 0x04, 0x99, 0x25, 0x82, 0xad, 0x29, 0x2d, 0x01, 0x2c, 0x19, 0x20,
+  0x59, 0x23, 0xc8, 0xba, 0x24, 0x11, 0x84, 0x1c, 0x8c, 0x2b, 0xc8, 0xc4, 0x12, 0x1b, 0x30, 0xa8,
+  0xd5, 0xb1, 0xba, 0x84, 0xa1, 0x13, 0x0e, 0xa1, 0xa1, 0x69, 0x33, 0x89, 0x12, 0x3a, 0x5b, 0xea,
+  0xc1, 0xc1, 0x03, 0xb0, 0x91, 0x4b, 0x0d, 0x4b, 0xb2, 0x08, 0x22, 0x59, 0xbb, 0xc3, 0x0a, 0xb9,
+  0x07, 0xa2, 0xa4, 0x13, 0x23, 0x98, 0xa4, 0x2f, 0x01, 0xb0, 0x29, 0x24, 0x0d, 0xa8, 0xac, 0x88,
+  0x99, 0x41, 0xc0, 0x94, 0x25, 0x0b, 0xa3, 0xa8, 0xae, 0x8a, 0x21, 0x15, 0x49, 0x80, 0x03, 0x8a,
+  0x6b, 0x4b, 0xbc, 0xa0, 0xa0, 0x14, 0x41, 0x04, 0xd0, 0x8b, 0x93, 0xd0, 0x38, 0x30, 0xad, 0x39,
+  0x4b, 0x39, 0xa0, 0x85, 0xd1, 0x32, 0x1c, 0xb9, 0x18, 0x44, 0x82, 0xc0, 0x81, 0x3a, 0xcc, 0xaa,
+  0x31, 0x0b, 0x11, 0x19, 0xcf, 0x90, 0x93, 0x95, 0x1b, 0x88, 0x94, 0x52, 0x08, 0x04, 0xcb, 0x8b,
+  0x3b, 0x90, 0x72, 0xa9, 0x88, 0x25, 0xb8, 0xbb, 0x16, 0x2a, 0x0b, 0xb8, 0x25, 0xa0, 0x02, 0xd2,
+  0xb5, 0x0a, 0xaa, 0x73, 0x88, 0xa1, 0x20, 0xb8, 0x1c, 0x27, 0x0a, 0x98, 0x01, 0xa3, 0x25, 0xd8,
+  0xb0, 0x21, 0x50, 0x1c, 0xc2, 0xa9, 0x20, 0x28, 0x3a, 0x7b, 0xc8, 0x2a, 0x03, 0x4b, 0xb1, 0x19,
+  0xae, 0x48, 0x93, 0x14, 0x82, 0x03, 0x92, 0x8e, 0xa9, 0x89, 0xc0, 0x0a, 0x80, 0xd2, 0xa0, 0x25,
+  0x02, 0x4c, 0x98, 0x9a, 0x43, 0x39, 0x8d, 0xaa, 0x49, 0xc3, 0x4b, 0x21, 0x11, 0xdc, 0xb9, 0x05,
+  0x31, 0xb2, 0xda, 0x13, 0x98, 0x0b, 0x63, 0x22, 0xa9, 0x6b, 0xbb, 0x4a, 0xa3, 0x33, 0xda, 0xa2,
+  0x3d, 0x89, 0xb0, 0x8e, 0xb8, 0x48, 0x28, 0xb2, 0x2d, 0xa2, 0x6a, 0xa3, 0x01, 0xd9, 0x29, 0x01,
+  0xbb, 0x08, 0x78, 0x6a, 0x29, 0x09, 0xc8, 0x23, 0x3a, 0x58, 0x8c, 0x09, 0x23, 0xa0, 0xe3, 0x29,
+  0x59, 0x8b, 0xca, 0xaa, 0x00, 0x92, 0x14, 0x97, 0x80, 0x38, 0x4a, 0x99, 0x01, 0xda, 0x95, 0x2a,
+  0x90, 0x49, 0x89, 0x96, 0xa8, 0x21, 0x98, 0x5b, 0x38, 0x29, 0x9f, 0x13, 0x81, 0xc8, 0x1a, 0xa2,
+  0xe2, 0xa1, 0x90, 0xc1, 0x21, 0x9c, 0x04, 0x42, 0xb0, 0x58, 0x20, 0x8a, 0x25, 0xd0, 0xc0, 0x23,
+  0xb1, 0xd3, 0x82, 0x2d, 0x18, 0x81, 0xc2, 0xb3, 0x8e, 0xab, 0xa1, 0x8a, 0x79, 0x23, 0x94, 0xa2,
+  0x22, 0xc0, 0x3c, 0x08, 0xc2, 0x91, 0x92, 0x4d, 0x1a, 0xb2, 0xa1, 0xcb, 0x95, 0x80, 0x2d, 0x31,
+  0xc9, 0x39, 0x91, 0xd8, 0x84, 0x20, 0x2c, 0x3a, 0x9d, 0x81, 0x18, 0x0c, 0x3d, 0x4a, 0x10, 0xb0,
+  0xa3, 0x25, 0x21, 0x09, 0xc6, 0x8b, 0xb8, 0x5a, 0xa9, 0x1a, 0x1a, 0x01, 0x71, 0x3c, 0xc9, 0x12,
+  0xa0, 0x93, 0xb3, 0x21, 0x89, 0x1f, 0xc2, 0x31, 0x3d, 0xc3, 0xba, 0xb9, 0x91, 0x18, 0x70, 0xb3,
+  0xca, 0xa8, 0x44, 0x95, 0x2a, 0x48, 0x89, 0x4b, 0x80, 0x38, 0x83, 0x8d, 0x83, 0x01, 0x09, 0x0c,
+  0xd5, 0x38, 0xc4, 0x00, 0x82, 0x9c, 0x21, 0x1b, 0x21, 0x8f, 0x19, 0xb9, 0x92, 0x94, 0x40, 0x2c,
+  0x5b, 0x1b, 0xa8, 0x08, 0xc8, 0x91, 0x87, 0xa0, 0x95, 0x21, 0x18, 0xca, 0x0b, 0xa4, 0x30, 0xca,
+  0x81, 0x36, 0x0a, 0xc9, 0x58, 0x09, 0xc2, 0xb3, 0x29, 0x8c, 0x1b, 0xac, 0xb8, 0x8a, 0xa3, 0x27,
+  0x89, 0xa5, 0xa3, 0x86, 0x31, 0xbb, 0x12, 0xa3, 0xc0, 0xa0, 0xa2, 0x5a, 0x4d, 0xa0, 0x1a, 0x40,
+  0x88, 0x95, 0x34, 0x33, 0x1c, 0xc0, 0x03, 0x91, 0x1e, 0xab, 0xb1, 0x28, 0x1d, 0x0c, 0x12, 0xac,
+  0x85, 0x88, 0x31, 0x91, 0x80, 0x5d, 0x13, 0x93, 0xd2, 0x01, 0x13, 0xd2, 0x90, 0xbb, 0x42, 0x82,
+  0xaf, 0xa8, 0xba, 0x3b, 0x6a, 0x39, 0xa9, 0xd9, 0x80, 0x4c, 0xb0, 0x95, 0xa9, 0x4a, 0x01, 0x89,
+  0x86, 0x14, 0x2a, 0x1b, 0x13, 0x38, 0x8d, 0x9a, 0x3b, 0x41, 0x01, 0x16, 0xb0, 0xa4, 0x9d, 0x31,
+  0x10, 0x23, 0xab, 0xd2, 0x0e, 0xb2, 0x31, 0xbd, 0x90, 0x35, 0x29, 0xc8, 0xb4, 0x8b, 0x0d, 0x48,
+  0x28, 0x02, 0xab, 0x98, 0x02, 0x2b, 0xa7, 0xd9, 0xba, 0x50, 0x41, 0x82, 0xc0, 0xa8, 0xb1, 0x80,
+  0x00, 0x3d, 0x04, 0x1b, 0x45, 0xc1, 0x02, 0x3a, 0x22, 0x8c, 0xaa, 0x02, 0x8b, 0x87, 0x83, 0xe4,
+  0x88, 0x21, 0x90, 0x88, 0x31, 0xaf, 0xb2, 0xc1, 0x20, 0x9a, 0x2a, 0x10, 0x2b, 0x27, 0xb4, 0x98,
+  0x3a, 0x0d, 0x42, 0x9d, 0x38, 0x3b, 0x09, 0xc4, 0xb9, 0x9b, 0x23, 0x4d, 0xb0, 0x43, 0x4a, 0xb2,
+  0x2d, 0xb2, 0x22, 0x21, 0xa5, 0x22, 0x0b, 0x30, 0xf9, 0x0b, 0x2d, 0xb3, 0x11, 0x1e, 0xa2, 0x9c,
+  0x82, 0xc3, 0x9b, 0xa5, 0x3b, 0x2b, 0x9c, 0x53, 0x88, 0x8c, 0x49, 0x22, 0x20, 0x8d, 0x99, 0xb3,
+  0x99, 0x16, 0x90, 0x35, 0x88, 0xb3, 0xcc, 0x20, 0x8b, 0x86, 0x28, 0x93, 0x1d, 0x31, 0xb0, 0xb8,
+  0x89, 0x27, 0x93, 0xd4, 0x82, 0xa2, 0xe3, 0x11, 0x1a, 0x1b, 0xa9, 0x2c, 0xe2, 0xb3, 0x89, 0x40,
+  0x03, 0xea, 0x0b, 0x81, 0x84, 0x99, 0x5b, 0x00, 0xb8, 0x0a, 0x78, 0xb1, 0xbb, 0x48, 0xa4, 0x83,
+  0x00, 0xbe, 0x22, 0x48, 0xa3, 0x0d, 0xa1, 0x0c, 0x3b, 0x92, 0xa8, 0xbb, 0x07, 0x93, 0x05, 0x81,
+  0xc0, 0x15, 0x08, 0xab, 0x4a, 0x8c, 0x24, 0xa1, 0x2a, 0x3b, 0x4a, 0x40, 0xa5, 0xc4, 0xb1, 0x88,
+  0x91, 0x3b, 0x20, 0xf8, 0xa1, 0xc8, 0x29, 0x13, 0x38, 0xd2, 0x10, 0xd2, 0x99, 0x8d, 0x03, 0x4b,
+  0x3b, 0xbc, 0x19, 0x79, 0x94, 0x11, 0xa0, 0x34, 0x8d, 0xa9, 0x30, 0x3c, 0xba, 0x94, 0xba, 0xb8,
+  0x9a, 0x14, 0x39, 0x27, 0x48, 0x02, 0xa8, 0x4c, 0xb0, 0x34, 0x1d, 0x0a, 0xa3, 0x10, 0x1c, 0x58,
+  0x1a, 0x9d, 0xaa, 0xa1, 0xa4, 0x51, 0x9a, 0x02, 0x95, 0x48, 0x49, 0xb2, 0x30, 0x2c, 0x11, 0xe0,
+  0xb2, 0x02, 0x1a, 0x29, 0x2f, 0x29, 0x39, 0x8b, 0x0f, 0x3b, 0x91, 0x25, 0xc2, 0x01, 0xd0, 0x92,
+  0x10, 0xda, 0x92, 0xac, 0x14, 0xb9, 0x04, 0xa0, 0x48, 0x8c, 0x4a, 0x3a, 0x22, 0x1d, 0x08, 0x8b,
+  0xb4, 0x83, 0xbb, 0x30, 0x71, 0x08, 0xa4, 0x9d, 0xa8, 0xb8, 0x05, 0x23, 0x21, 0x2a, 0x0d, 0x21,
+  0x9d, 0x33, 0xc4, 0xca, 0x12, 0x21, 0x88, 0x04, 0x00, 0x29, 0xf8, 0x8a, 0x09, 0xa9, 0xa8, 0xa7,
+  0x1c, 0x08, 0x91, 0xea, 0x43, 0x09, 0xb9, 0x34, 0xaa, 0x42, 0x98, 0x4b, 0x34, 0x0d, 0x13, 0xc9,
+  0x1b, 0x3c, 0x81, 0x53, 0xd0, 0x80, 0x3a, 0xc1, 0x9a, 0xa1, 0x40, 0x2b, 0x69, 0xa3, 0xd1, 0x08,
+  0x91, 0xad, 0xa1, 0x29, 0x05, 0x09, 0x39, 0xbb, 0x70, 0x9a, 0x9b, 0x88, 0x86, 0x00, 0x53, 0x48,
+  0x3a, 0x10, 0xba, 0x4c, 0x19, 0x08, 0xbc, 0x39, 0xf0, 0x82, 0x9b, 0x5a, 0x91, 0x99, 0x89, 0x26,
+  0x42, 0xb0, 0xac, 0x19, 0x14, 0xa8, 0x16, 0xb9, 0x94, 0xb2, 0x91, 0x94, 0xac, 0x53, 0x10, 0xaa,
+  0x5c, 0x1b, 0x99, 0x58, 0xa9, 0x11, 0xa0, 0xb4, 0x9b, 0x01, 0x42, 0x86, 0x3c, 0x8c, 0x1a, 0xb3,
+  0x59, 0xa1, 0x31, 0xc8, 0xa2, 0xcb, 0xb0, 0x38, 0x82, 0xb7, 0x68, 0x22, 0x82, 0x82, 0xad, 0x3a,
+  0x8a, 0xd0, 0x32, 0x43, 0xca, 0x12, 0xaa, 0x4c, 0x28, 0xa9, 0x48, 0xa4, 0x91, 0x24, 0xb8, 0x4c,
+  0xb2, 0xad, 0xc3, 0x02, 0x80, 0x08, 0x3e, 0xbb, 0x12, 0x24, 0xd4, 0x9b, 0xa2, 0x30, 0x0b, 0x26,
+  0x89, 0x5a, 0x02, 0x1a, 0x38, 0x5b, 0x90, 0x38, 0x69, 0x2e, 0x90, 0xc2, 0x19, 0x91, 0x03, 0xae,
+  0x0b, 0xa9, 0xc0, 0x34, 0x80, 0x1a, 0x79, 0x12, 0xc1, 0x8b, 0x8b, 0x25, 0xb3, 0xcb, 0xc9, 0x91,
+  0x12, 0x91, 0x33, 0x94, 0xb8, 0x8f, 0xa1, 0x44, 0x22, 0xc8, 0x2a, 0xb4, 0x8d, 0x19, 0x3a, 0x59,
+  0x99, 0x5a, 0x20, 0x0c, 0x32, 0xc3, 0x49, 0x38, 0xeb, 0x92, 0x88, 0x30, 0x33, 0x2c, 0x8f, 0xa2,
+  0x09, 0x2a, 0xc0, 0xc3, 0x91, 0xcb, 0x25, 0x18, 0x24, 0xb8, 0x48, 0x81, 0xa2, 0x38, 0x2f, 0x0d,
+  0xa8, 0x82, 0x8b, 0x80, 0xae, 0xa2, 0x39, 0x44, 0xca, 0x02, 0xc8, 0x98, 0x52, 0xaa, 0xb2, 0x09,
+  0x86, 0x09, 0x0a, 0x93, 0xa4, 0x2c, 0x50, 0x3b, 0x91, 0x2b, 0x03, 0x38, 0xa2, 0x8f, 0x51, 0x04,
+  0xba, 0x21, 0x2b, 0x97, 0x93, 0x20, 0xac, 0xc4, 0x89, 0x02, 0x04, 0xbd, 0x0b, 0x1c, 0xa1, 0x84,
+  0x84, 0x00, 0x3a, 0x9d, 0x49, 0xc0, 0x18, 0xb2, 0x94, 0x00, 0x68, 0x32, 0x01, 0xcc, 0x11, 0xa0,
+  0x4a, 0xd8, 0x89, 0x5b, 0x22, 0x8c, 0x2b, 0x32, 0xd2, 0xbb, 0x33, 0xb0, 0xc5, 0xc8, 0x84, 0x21,
+  0x30, 0x22, 0xd4, 0xa0, 0xa9, 0xb4, 0xb9, 0x85, 0x81, 0xa2, 0x29, 0x42, 0x4b, 0x81, 0x8a, 0xbf,
+  0xaa, 0x2c, 0x13, 0x3b, 0x14, 0x0b, 0xb9, 0x4e, 0x31, 0xab, 0xd0, 0x19, 0x50, 0x10, 0x30, 0xfa,
+  0x13, 0xba, 0x2a, 0xbc, 0xb0, 0x89, 0xd9, 0x98, 0x10, 0x81, 0x7d, 0x02, 0x9a, 0x05, 0x39, 0xb3,
+  0x10, 0x9b, 0x42, 0x12, 0xe9, 0x3c, 0x24, 0x2b, 0x9a, 0x5b, 0x23, 0x49, 0x0a, 0xc1, 0xc9, 0xb3,
+  0x9c, 0x22, 0x50, 0xb2, 0xc0, 0xba, 0x8c, 0x16, 0x9a, 0x01, 0xbb, 0x22, 0x4c, 0x29, 0x91, 0x87,
+  0x00, 0x53, 0x81, 0x01, 0x24, 0xc1, 0xa8, 0x2b, 0x1c, 0x98, 0x21, 0x27, 0xb1, 0x90, 0xa3, 0xfb,
+  0x89, 0xca, 0xb0, 0x0b, 0x08, 0x81, 0xcd, 0x71, 0x88, 0x29, 0x30, 0xac, 0x89, 0x80, 0x07, 0x30,
+  0x01, 0xa2, 0x3d, 0x00, 0x1c, 0x18, 0x5b, 0x99, 0xb3, 0x8a, 0xa7, 0x2a, 0x8b, 0x33, 0xd3, 0x93,
+  0x93, 0x85, 0xcb, 0xc8, 0x4a, 0x30, 0x0b, 0xd8, 0x59, 0x81, 0x31, 0x03, 0x2e, 0x9b, 0x0b, 0x00,
+  0xc8, 0x12, 0x5a, 0x34, 0xc4, 0x89, 0x2a, 0xc3, 0x48, 0x82, 0x8d, 0x10, 0x9b, 0xc4, 0xa0, 0x92,
+  0xa5, 0xb3, 0xac, 0x0b, 0x85, 0xc2, 0x10, 0x1b, 0x80, 0x24, 0xcb, 0x8c, 0x52, 0x14, 0x2a, 0x81,
+  0x04, 0xac, 0x1a, 0x40, 0xbc, 0x94, 0x29, 0x2a, 0x04, 0xd0, 0x01, 0x82, 0xac, 0xc2, 0x9a, 0x13,
+  0x79, 0x90, 0x30, 0x89, 0x60, 0xb0, 0xa1, 0x28, 0x0e, 0x19, 0x02, 0xa0, 0x0b, 0xc1, 0x04, 0xba,
+  0x36, 0xa4, 0x1c, 0x2c, 0x91, 0x28, 0x8c, 0x22, 0xd0, 0x9a, 0x1c, 0x51, 0x30, 0x08, 0x8a, 0x85,
+  0x8d, 0x1a, 0x00, 0x24, 0xbc, 0x02, 0x82, 0x0e, 0x12, 0xbc, 0x04, 0x2a, 0x24, 0x21, 0x8d, 0xa2,
+  0x4b, 0xd1, 0x1b, 0x13, 0xd3, 0xa0, 0xb9, 0xc0, 0x12, 0x25, 0x3b, 0x40, 0xd8, 0xa1, 0x84, 0x83,
+  0x1a, 0x91, 0x8c, 0xc2, 0x0c, 0xd1, 0x49, 0x29, 0xb9, 0x40, 0xc2, 0x02, 0x10, 0xd0, 0xc2, 0x49,
+  0x80, 0x82, 0x09, 0x8e, 0x4c, 0x12, 0x3b, 0x3a, 0x10, 0xc2, 0x83, 0x33, 0xad, 0xda, 0x13, 0x88,
+  0xd5, 0x08, 0x80, 0xaa, 0xa2, 0x26, 0xa4, 0xb8, 0xc9, 0x30, 0xa3, 0x5a, 0x2c, 0xd3, 0x03, 0x99,
+  0x81, 0x43, 0xdb, 0x11, 0xc0, 0x3c, 0x89, 0xa4, 0xc1, 0x10, 0x2a, 0x15, 0x32, 0x80, 0x21, 0x08,
+  0xaf, 0x2a, 0xb2, 0xd5, 0x8b, 0x3b, 0x98, 0x03, 0x91, 0x78, 0x0a, 0xc8, 0x0b, 0x83, 0x4d, 0x3a,
+  0x1c, 0x9a, 0x38, 0x88, 0x18, 0x7b, 0xb9, 0x91, 0xc4, 0x92, 0x95, 0x90, 0x90, 0x82, 0xb3, 0x10,
+  0x25, 0xf9, 0xaa, 0xaa, 0x83, 0x97, 0x99, 0x29, 0xa2, 0x25, 0x18, 0x82, 0x8d, 0x85, 0xb0, 0x43,
+  0x99, 0xa0, 0xcb, 0x12, 0x36, 0x33, 0xe2, 0x2a, 0x02, 0xa0, 0xd9, 0xa0, 0x3c, 0x30, 0x0a, 0x4b,
+  0x1b, 0xb0, 0x0f, 0x30, 0xcb, 0x49, 0x2a, 0xad, 0x02, 0x1b, 0x86, 0x80, 0xc1, 0x13, 0xa9, 0x6a,
+  0x82, 0x00, 0xda, 0xb2, 0xc1, 0xab, 0x23, 0x17, 0xb0, 0x84, 0xc3, 0x82, 0x99, 0x1b, 0x3a, 0x3c,
+};
+
+const audio_sample_t snd_explosion = {AUDIO_ADPCM4, 8000, snd_explosion_data};
+
+static const uint8_t snd_hit_data[] = {
+  0x77, 0x77, 0x77, 0x77, 0x05, 0x18, 0x21, 0x29, 0x20, 0x91, 0x29, 0x80, 0xe4, 0x0b, 0x3b, 0x3c,
+  0xba, 0x13, 0x19, 0x68, 0x88, 0xaa, 0xf1, 0x20, 0x80, 0xeb, 0x8b, 0x12, 0x0c, 0x90, 0xe1, 0x8a,
+  0x98, 0x1b, 0xbb, 0x9d, 0xb0, 0xa0, 0x1f, 0x8a, 0xc2, 0xac, 0x2a, 0xd8, 0x09, 0x9a, 0x84, 0x09,
+  0x1b, 0xc2, 0x91, 0x15, 0x05, 0xa9, 0x42, 0x0b, 0x18, 0x16, 0x32, 0x29, 0x18, 0x41, 0x7a, 0x89,
+  0x44, 0x38, 0x4a, 0xa9, 0x93, 0xa3, 0x1a, 0x3a, 0x71, 0x61, 0x92, 0x23, 0x00, 0x8a, 0x9a, 0x92,
+  0x15, 0xb4, 0x03, 0xc1, 0x92, 0x82, 0xae, 0xd2, 0x80, 0xa1, 0x98, 0xf1, 0xa8, 0xb0, 0xbb, 0xa3,
+  0x13, 0x8e, 0x1f, 0xb0, 0x89, 0xb0, 0x82, 0x0f, 0xa1, 0x10, 0xe1, 0xa0, 0x00, 0x2a, 0x30, 0xa2,
+  0x98, 0xad, 0xea, 0x2a, 0x02, 0x80, 0x08, 0x9f, 0xa4, 0xa8, 0x49, 0x4b, 0x42, 0x49, 0x88, 0x04,
+  0xb2, 0x8a, 0x6a, 0x48, 0x92, 0x02, 0xa1, 0x35, 0x21, 0x98, 0x58, 0xa1, 0x18, 0xab, 0xa2, 0x07,
+  0x34, 0x18, 0x15, 0x48, 0x3a, 0x99, 0x19, 0x04, 0x3c, 0x91, 0xf2, 0x18, 0x80, 0x9d, 0x0a, 0x9a,
+  0x89, 0xd2, 0xcb, 0x1c, 0xc2, 0x19, 0x21, 0xd2, 0x9d, 0xb9, 0x9a, 0xb0, 0x9c, 0xac, 0x3b, 0xc3,
+  0x32, 0xa0, 0xf3, 0x3b, 0x39, 0xc1, 0x1b, 0x3b, 0xb2, 0xb1, 0x27, 0x12, 0x4c, 0x02, 0x01, 0x04,
+  0x19, 0xda, 0x52, 0x92, 0x21, 0x12, 0x42, 0x15, 0x22, 0x9a, 0x08, 0x82, 0x57, 0x28, 0xa3, 0x42,
+  0x38, 0x92, 0x3b, 0x98, 0x48, 0x26, 0xc2, 0xc9, 0x9a, 0x0a, 0x2b, 0xb8, 0xa3, 0x2f, 0x32, 0xcb,
+  0xd1, 0x03, 0xe9, 0x99, 0xb2, 0xd8, 0x02, 0x01, 0xbd, 0x8c, 0xab, 0x3b, 0xb1, 0xc4, 0xab, 0xd2,
+  0x81, 0xb2, 0xbd, 0x01, 0xb1, 0xba, 0x24, 0x2c, 0x8d, 0x39, 0x22, 0xdb, 0x22, 0x4c, 0x83, 0x11,
+  0x06, 0x20, 0xb0, 0x81, 0x08, 0x09, 0x47, 0x31, 0x1a, 0x34, 0x98, 0x16, 0x82, 0x1a, 0x51, 0x22,
+  0x31, 0x6b, 0x01, 0xaa, 0x32, 0xa2, 0x40, 0x52, 0x2c, 0x1c, 0xb8, 0x28, 0xd3, 0x38, 0x2d, 0xa3,
+  0xdb, 0x8a, 0x31, 0x38, 0x8b, 0xbf, 0xac, 0xc1, 0x89, 0xc8, 0x1b, 0xc9, 0x98, 0xc4, 0xba, 0x40,
+  0xc1, 0x98, 0x03, 0xb8, 0x8a, 0x0b, 0x9f, 0x94, 0x18, 0x12, 0x1a, 0x0d, 0xad, 0x89, 0xb2, 0xa5,
+  0x25, 0x21, 0x83, 0xd3, 0x12, 0xa2, 0x1c, 0x22, 0x3a, 0x87, 0x42, 0x01, 0x08, 0xaa, 0x98, 0x07,
+  0x14, 0x32, 0x02, 0x1a, 0x48, 0x2b, 0x08, 0x72, 0x84, 0x32, 0x88, 0x2b, 0x28, 0x04, 0x90, 0x9f,
+  0xac, 0x93, 0x8c, 0x1c, 0xaa, 0x40, 0x0c, 0x90, 0xd9, 0x89, 0x39, 0x2a, 0x11, 0xbb, 0xf2, 0xbe,
+  0x88, 0x12, 0x9a, 0x0d, 0xc8, 0xc2, 0x8a, 0xb2, 0x2a, 0x4a, 0xad, 0x28, 0x1b, 0x34, 0xd2, 0xa8,
+  0xaa, 0x13, 0x9b, 0x7c, 0x02, 0x43, 0x99, 0x29, 0x11, 0x14, 0x38, 0xa6, 0xa1, 0x04, 0x14, 0x14,
+  0x40, 0x92, 0x4a, 0x3a, 0x14, 0x03, 0x02, 0xcb, 0x02, 0x1c, 0x99, 0x16, 0x22, 0x88, 0x99, 0x53,
+  0x1a, 0xdc, 0x11, 0x49, 0xa0, 0x11, 0x1d, 0xc9, 0x99, 0xc8, 0x0c, 0x00, 0x2a, 0xbf, 0x0b, 0xb8,
+  0xd8, 0x3b, 0xc2, 0x80, 0x18, 0x20, 0x20, 0x8f, 0x1a, 0x11, 0xc0, 0x0a, 0x8f, 0x88, 0x89, 0xa1,
+  0x30, 0x8b, 0x49, 0xbc, 0x29, 0x6d, 0x28, 0xc8, 0x10, 0x5a, 0x01, 0x8b, 0x30, 0x29, 0x48, 0x15,
+  0x24, 0x3a, 0x41, 0x85, 0x93, 0xb2, 0x05, 0x10, 0x88, 0x33, 0x8c, 0x87, 0x18, 0x58, 0x92, 0xa9,
+  0x80, 0x42, 0xbb, 0x8b, 0x0b, 0x68, 0x44, 0x09, 0x0b, 0x23, 0xbd, 0x02, 0xf1, 0xb8, 0x10, 0xea,
+  0x20, 0xa8, 0x0a, 0xb2, 0x2d, 0xaa, 0x0b, 0xa2, 0xd1, 0x1b, 0x02, 0x09, 0x32, 0xde, 0x8e, 0xc9,
+  0xa2, 0xb2, 0x19, 0x10, 0xd8, 0x12, 0x08, 0x83, 0x88, 0x43, 0x4a, 0x39, 0x79, 0x14, 0x98, 0x28,
+  0x1c, 0xa5, 0x13, 0x16, 0x11, 0xa8, 0x43, 0x91, 0x00, 0x18, 0x70, 0x41, 0xa2, 0x92, 0x01, 0xa2,
+  0xa2, 0x85, 0x51, 0xda, 0x02, 0x20, 0xa2, 0xa4, 0x10, 0xbb, 0xcc, 0x3a, 0x2f, 0x90, 0xb8, 0x11,
+  0xac, 0xcc, 0x81, 0x99, 0xcd, 0x89, 0x8b, 0xaa, 0xb1, 0x12, 0xfc, 0x81, 0x08, 0x29, 0x1e, 0xa0,
+  0x12, 0xf8, 0x88, 0x18, 0x2b, 0xba, 0xbc, 0x19, 0xa6, 0x88, 0x82, 0xb3, 0x3b, 0x96, 0x3a, 0x7a,
+  0x92, 0x91, 0x09, 0x27, 0x12, 0x02, 0x02, 0x50, 0x08, 0x52, 0x08, 0x90, 0x48, 0x19, 0x38, 0xa4,
+  0x91, 0x34, 0x9a, 0x88, 0x47, 0x82, 0xa0, 0x58, 0x8b, 0x4a, 0x89, 0x1c, 0x20, 0x21, 0xbc, 0xe8,
+  0x12, 0xa9, 0x8e, 0xb1, 0x1c, 0x19, 0x29, 0xd2, 0x98, 0x1a, 0x08, 0x9e, 0x99, 0x0f, 0xb8, 0x81,
+  0x00, 0x29, 0x9f, 0x8a, 0xba, 0xab, 0x00, 0xe0, 0x91, 0xab, 0x09, 0x39, 0x7a, 0x85, 0x49, 0x29,
+  0x03, 0x94, 0x42, 0x33, 0x08, 0x84, 0xba, 0x99, 0x07, 0x40, 0x02, 0x09, 0x68, 0x30, 0xa8, 0x95,
+  0x12, 0x48, 0x48, 0x30, 0x93, 0x21, 0xe1, 0x11, 0xbb, 0x1b, 0x4c, 0x48, 0x91, 0x8b, 0x30, 0xb4,
+  0x0e, 0x00, 0x01, 0x18, 0x1f, 0xc8, 0x8b, 0x2a, 0x9b, 0x3a, 0x1d, 0x98, 0x02, 0xb8, 0xef, 0xa8,
+  0x98, 0x1a, 0x01, 0x9a, 0x23, 0xfa, 0xc0, 0x0b, 0x1b, 0xc1, 0x33, 0x40, 0xa1, 0x32, 0xf0, 0x09,
+  0xa9, 0xb8, 0xc0, 0x94, 0x95, 0x21, 0x39, 0x31, 0x2a, 0x27, 0x09, 0xa5, 0x11, 0xa1, 0x7a, 0x81,
+  0x91, 0x59, 0x93, 0x90, 0x21, 0x15, 0x63, 0xa0, 0x29, 0x39, 0xba, 0x06, 0x10, 0x8b, 0x38, 0x13,
+  0x8c, 0xb4, 0x0a, 0xc6, 0x80, 0x18, 0x0d, 0x0a, 0xa1, 0x0d, 0x80, 0x20, 0x8e, 0xc1, 0xb1, 0x91,
+  0x02, 0xd8, 0x9b, 0xc0, 0xe1, 0xb9, 0xab, 0x0c, 0xa0, 0x82, 0xe1, 0xb9, 0x3a, 0x1b, 0x38, 0x35,
+  0x44, 0x39, 0xb1, 0x0a, 0xc4, 0x23, 0x80, 0x89, 0x04, 0x73, 0xba, 0x95, 0x03, 0xa9, 0x31, 0xab,
+  0x70, 0x85, 0x10, 0x02, 0x10, 0x18, 0x15, 0x1a, 0x82, 0x30, 0xa1, 0x97, 0x95, 0x01, 0x20, 0x94,
+  0xab, 0x14, 0x92, 0x2a, 0x50, 0x9d, 0x21, 0x19, 0x0f, 0x0a, 0xca, 0x1a, 0x20, 0xfa, 0x90, 0x88,
+  0xda, 0x09, 0x29, 0x90, 0xf3, 0x99, 0x1b, 0x8b, 0xaa, 0xb9, 0x1c, 0xd0, 0xb3, 0xab, 0x09, 0xb7,
+  0x11, 0x8a, 0x68, 0x82, 0x8b, 0x04, 0x28, 0x2c, 0xb3, 0x71, 0x08, 0x10, 0x81, 0x17, 0x84, 0x80,
+  0x03, 0xa2, 0x92, 0x87, 0x13, 0x18, 0x24, 0x12, 0xb1, 0x14, 0xa2, 0x04, 0x7a, 0x01, 0x02, 0x49,
+  0x01, 0x99, 0x2e, 0x81, 0x19, 0x9e, 0x0a, 0x09, 0xa2, 0xcd, 0x81, 0xc9, 0xbb, 0xc2, 0x89, 0xb0,
+  0x11, 0xd4, 0xca, 0xa9, 0x1c, 0x19, 0x12, 0x8e, 0x82, 0xa8, 0xa2, 0x9b, 0xfa, 0x10, 0xe0, 0x18,
+  0x8b, 0x81, 0xd9, 0xa1, 0x01, 0xc3, 0x15, 0xa2, 0x92, 0x23, 0x79, 0x08, 0xa1, 0x84, 0xa3, 0x3b,
+  0x2a, 0x7a, 0x23, 0xb9, 0xa4, 0x15, 0x25, 0x31, 0x90, 0x3a, 0x23, 0x01, 0x07, 0x4a, 0x32, 0x83,
+  0x0c, 0x88, 0xb3, 0xa6, 0x29, 0x2a, 0x9b, 0xc9, 0x44, 0xd3, 0x9b, 0x81, 0x43, 0xc8, 0xda, 0x09,
+  0xba, 0x28, 0xf8, 0xa9, 0x91, 0x19, 0xab, 0xc4, 0x09, 0x8c, 0x19, 0x89, 0x89, 0xfc, 0xa9, 0x1c,
+  0x88, 0xd1, 0x1a, 0x3b, 0x48, 0x92, 0x99, 0x93, 0x73, 0x81, 0x81, 0x90, 0x35, 0x80, 0x0c, 0xa4,
+  0xa3, 0x93, 0x52, 0x4c, 0x90, 0x10, 0x94, 0x8a, 0x13, 0x27, 0x10, 0x39, 0x93, 0xa4, 0x17, 0x12,
+  0x29, 0x81, 0x32, 0xb2, 0x27, 0x28, 0xa4, 0xbb, 0xc8, 0x2a, 0x1e, 0x19, 0x0a, 0xdb, 0x92, 0x39,
+  0x0a, 0x9e, 0x13, 0x21, 0xdd, 0x0b, 0xa8, 0xc1, 0x98, 0x1c, 0x1c, 0x90, 0xc9, 0x0c, 0x89, 0xb9,
+  0x1c, 0xc8, 0xb2, 0xcb, 0x21, 0x3d, 0x31, 0x99, 0x9d, 0xa3, 0x25, 0xb3, 0x38, 0xba, 0x1e, 0x91,
+  0x39, 0x7a, 0x84, 0x29, 0x98, 0x33, 0x88, 0x65, 0x10, 0x19, 0x82, 0x23, 0xab, 0x92, 0x45, 0x63,
+  0x21, 0x39, 0x14, 0x02, 0xb0, 0x30, 0x44, 0x48, 0xd9, 0x08, 0xa1, 0x1c, 0x3a, 0xc0, 0x20, 0x4c,
+  0xac, 0x00, 0x20, 0xeb, 0x98, 0x99, 0xb2, 0x80, 0x2c, 0xbc, 0x0d, 0xa0, 0x0d, 0x8a, 0xe0, 0x2b,
+  0xb1, 0x9b, 0xb3, 0xd4, 0xc2, 0x20, 0x20, 0x3a, 0xd2, 0x11, 0x9c, 0x81, 0xa3, 0xda, 0x3a, 0x5a,
+  0x02, 0xea, 0x39, 0x43, 0x49, 0x88, 0x33, 0x91, 0x9c, 0x99, 0x03, 0x79, 0xa1, 0x39, 0x4a, 0x39,
+  0x34, 0x78, 0x24, 0x32, 0x08, 0x38, 0xaa, 0x10, 0x87, 0x0b, 0xb3, 0x11, 0x95, 0x50, 0x82, 0x09,
+  0x00, 0xb0, 0xc0, 0xcd, 0xb8, 0xba, 0x99, 0x85, 0xb8, 0x28, 0xaa, 0xdd, 0xdb, 0xb9, 0x88, 0x2b,
+  0x09, 0x29, 0xf1, 0xa9, 0xb1, 0xfb, 0xa2, 0x3a, 0x8c, 0x29, 0x42, 0xda, 0xb9, 0x19, 0xa4, 0x49,
+  0x81, 0xbb, 0x39, 0x2c, 0xa6, 0x00, 0x43, 0x03, 0x30, 0x71, 0x11, 0x12, 0x30, 0x72, 0x08, 0x14,
+  0x91, 0x89, 0x01, 0x29, 0xc3, 0x44, 0x89, 0x2b, 0x14, 0x32, 0xbc, 0x72, 0x02, 0xa9, 0x42, 0xb8,
+  0x39, 0x93, 0x96, 0xac, 0x13, 0x9c, 0x89, 0x3d, 0xa8, 0x0d, 0x12, 0x21, 0xf8, 0x8a, 0xb9, 0x2c,
+  0xa8, 0x29, 0x0e, 0x2b, 0x20, 0xab, 0xbc, 0x33, 0x13, 0x9c, 0xd2, 0x01, 0xae, 0xc8, 0xba, 0x3c,
+  0x13, 0x18, 0x90, 0xe9, 0x8a, 0x29, 0xaa, 0x37, 0x23, 0x0a, 0x34, 0x0a, 0xd2, 0x49, 0x12, 0x21,
+  0xb8, 0x37, 0x30, 0x24, 0x52, 0x3a, 0x38, 0xc2, 0xb1, 0x83, 0x98, 0x26, 0x39, 0x4a, 0x31, 0x61,
+  0x91, 0x80, 0xba, 0x43, 0x04, 0xaa, 0x80, 0x04, 0xdc, 0x1d, 0xa9, 0x8c, 0xb2, 0x01, 0x88, 0x8d,
+  0x28, 0xda, 0x91, 0x9b, 0xbe, 0xa1, 0xd1, 0xa9, 0x80, 0xba, 0xcc, 0xa1, 0x9c, 0x48, 0x99, 0x13,
+  0xa9, 0xcc, 0x18, 0x0c, 0x2b, 0x38, 0x85, 0xc8, 0x3a, 0x95, 0x35, 0x08, 0x82, 0x38, 0x01, 0xc3,
+  0x82, 0x4a, 0x16, 0x32, 0x71, 0xa8, 0x22, 0x00, 0x80, 0x36, 0x28, 0xa0, 0x15, 0x34, 0x93, 0x3b,
+  0x2b, 0x4b, 0xbc, 0x05, 0x58, 0xa1, 0x81, 0x99, 0xab, 0xcb, 0x95, 0x20, 0xd1, 0x23, 0xc1, 0x81,
+  0x9f, 0x88, 0x01, 0x20, 0x0d, 0x0d, 0x8c, 0xb9, 0x08, 0xbb, 0x91, 0x9e, 0xa1, 0x9a, 0x13, 0x0a,
+  0xcf, 0x08, 0xba, 0xa3, 0xbb, 0x8c, 0x33, 0x19, 0x30, 0x4d, 0x5c, 0x18, 0x19, 0x38, 0x44, 0x04,
+  0x80, 0x18, 0xa5, 0x83, 0x92, 0x14, 0x18, 0xab, 0x87, 0x21, 0x69, 0x38, 0x11, 0xa2, 0x41, 0x33,
+  0xb2, 0x18, 0x4d, 0x1a, 0xa9, 0x17, 0x11, 0x20, 0x8c, 0x0a, 0x48, 0xaa, 0x23, 0xba, 0xf2, 0xb0,
+  0xd2, 0x12, 0xbd, 0x12, 0x1b, 0xc9, 0xa8, 0x1d, 0xb8, 0x0a, 0xbc, 0x39, 0xaf, 0x28, 0xe2, 0xa8,
+  0xaa, 0x38, 0xa2, 0x03, 0x1f, 0x3a, 0x2c, 0x89, 0x8b, 0x82, 0x85, 0xc3, 0x01, 0xa3, 0x48, 0x9b,
+  0x15, 0xd0, 0x02, 0x89, 0x6a, 0x43, 0x91, 0x40, 0x8a, 0x89, 0x48, 0x6a, 0x91, 0x28, 0x20, 0x19,
+  0xa3, 0x74, 0x91, 0x92, 0x99, 0x82, 0x98, 0x87, 0x33, 0x20, 0x59, 0xb1, 0xb2, 0xb8, 0x20, 0xb4,
+  0x8f, 0x03, 0x28, 0x48, 0x02, 0xf0, 0x8b, 0x19, 0xd0, 0x8b, 0x9d, 0xaa, 0x80, 0xe8, 0x01, 0x91,
+  0x18, 0x98, 0xcf, 0x00, 0xb9, 0x29, 0xc0, 0xbb, 0xb2, 0x94, 0x9b, 0x5b, 0x8c, 0xb0, 0x7a, 0x02,
+  0x32, 0x22, 0x80, 0x12, 0xa6, 0x23, 0x48, 0x8a, 0x61, 0x39, 0x41, 0x19, 0x24, 0x22, 0x01, 0x0c,
+  0x26, 0x8b, 0x39, 0x4a, 0x8a, 0x96, 0x80, 0xa2, 0x92, 0x86, 0xb1, 0x14, 0x13, 0x1c, 0xb9, 0x04,
+  0xda, 0xc1, 0xb9, 0x2a, 0x5a, 0x2a, 0x81, 0xe0, 0x11, 0xd8, 0xab, 0xa2, 0x8b, 0x1e, 0xa0, 0x1c,
+  0x01, 0x2c, 0xe8, 0x01, 0x1b, 0x88, 0x9e, 0xb0, 0xba, 0xb0, 0x83, 0x52, 0xc3, 0x29, 0x4a, 0x09,
+  0x2a, 0x8b, 0x63, 0xab, 0x4a, 0x23, 0xa5, 0xc1, 0x20, 0x59, 0x08, 0x83, 0x13, 0xab, 0x56, 0x32,
+  0x32, 0x14, 0xa0, 0xa9, 0x1a, 0x58, 0x85, 0x34, 0x19, 0xb9, 0x98, 0xac, 0x36, 0xa4, 0x4a, 0x88,
+  0x02, 0xa9, 0x3b, 0xb6, 0x0a, 0x09, 0xb8, 0x8d, 0xc3, 0x30, 0xb8, 0x15, 0xd3, 0xa9, 0x81, 0xaa,
+  0xe2, 0xbd, 0xba, 0x82, 0xa1, 0xd9, 0xa2, 0x1b, 0x42, 0xca, 0xa1, 0x9e, 0xaa, 0xa1, 0xa0, 0x2e,
+  0x12, 0xc0, 0x38, 0x03, 0xd1, 0x3c, 0x9c, 0x30, 0x53, 0x93, 0xb9, 0xb0, 0x27, 0xa1, 0x85, 0x82,
+  0x98, 0x02, 0x53, 0x98, 0x22, 0x11, 0xa8, 0x47, 0x22, 0x91, 0x06, 0x80, 0x40, 0x20, 0x1a, 0x99,
+  0x89, 0x03, 0xa7, 0x83, 0x92, 0x5b, 0x10, 0x18, 0x04, 0xd3, 0x1c, 0x01, 0xcb, 0xe2, 0xbb, 0xaa,
+  0x9a, 0x9e, 0xb8, 0x39, 0x20, 0xa2, 0xdf, 0x00, 0xb9, 0x81, 0xc9, 0x80, 0x30, 0x1e, 0x99, 0x2a,
+  0xd9, 0xa8, 0xbb, 0x08, 0x9c, 0x16, 0x13, 0x14, 0xb8, 0x4a, 0x92, 0x39, 0x86, 0x04, 0x99, 0x53,
+  0x89, 0x89, 0x18, 0x50, 0x08, 0x82, 0x8a, 0x7a, 0x38, 0x26, 0x18, 0x01, 0x89, 0x09, 0x81, 0x86,
+  0x42, 0x41, 0x03, 0xaa, 0x83, 0xc9, 0x7a, 0x20, 0xa2, 0x4a, 0x0a, 0x93, 0x5a, 0x21, 0xd8, 0xbd,
+  0x81, 0x21, 0x1c, 0xdb, 0x2a, 0xb1, 0x1a, 0x10, 0xdd, 0x08, 0x08, 0xac, 0xa2, 0x10, 0x8c, 0xb8,
+  0x1a, 0x41, 0x8d, 0x19, 0x9e, 0x1a, 0xe0, 0xaa, 0x21, 0xb9, 0x21, 0x98, 0xa8, 0x07, 0x13, 0x89,
+  0x54, 0x94, 0xa8, 0x08, 0x54, 0x91, 0x80, 0x38, 0x92, 0x70, 0x22, 0x80, 0xa4, 0x62, 0xa1, 0x39,
+  0x19, 0x32, 0x49, 0x04, 0x28, 0x14, 0x23, 0xb4, 0xd0, 0x9b, 0xb3, 0x4a, 0x04, 0x1a, 0xbf, 0x9b,
+  0x29, 0x29, 0xb9, 0xfb, 0x28, 0x22, 0x9e, 0xc1, 0x9b, 0x0b, 0x21, 0x0d, 0xb0, 0x2d, 0xb0, 0x0b,
+  0x9c, 0xbb, 0x08, 0xd4, 0xa9, 0xa0, 0x69, 0x01, 0xa1, 0x51, 0x3b, 0xb9, 0x42, 0xaa, 0x90, 0x71,
+  0x09, 0x99, 0x63, 0x10, 0x33, 0x85, 0x39, 0x42, 0x3a, 0xaa, 0x0a, 0x52, 0x06, 0x01, 0x90, 0x0a,
+  0x44, 0x02, 0x90, 0x78, 0x81, 0x01, 0x88, 0x50, 0xa3, 0xa0, 0xb4, 0xd0, 0x80, 0xbb, 0x01, 0xda,
+  0x89, 0x2b, 0x1b, 0xf3, 0x18, 0x13, 0x83, 0x1e, 0xa0, 0xf3, 0xa0, 0x19, 0x9d, 0xcb, 0xa1, 0xb9,
+  0x93, 0xc2, 0xc9, 0x00, 0x88, 0x4b, 0xae, 0x30, 0xb1, 0x94, 0x08, 0x30, 0xc3, 0xb3, 0xf1, 0x90,
+  0x14, 0x49, 0x2b, 0xd1, 0xa0, 0x95, 0x01, 0x59, 0x10, 0x98, 0xa0, 0x28, 0x62, 0x88, 0x42, 0x80,
+  0x29, 0x71, 0x18, 0x83, 0x7a, 0x02, 0x08, 0x39, 0x24, 0x28, 0xa4, 0xb1, 0x15, 0x19, 0xca, 0xb8,
+  0x38, 0xb0, 0x0c, 0x59, 0x8c, 0x99, 0x9c, 0xb8, 0x8a, 0x95, 0xfa, 0x88, 0x8b, 0xa0, 0x01, 0xbe,
+  0x08, 0xb0, 0x1a, 0x8a, 0x0d, 0xe9, 0x11, 0x33, 0xa8, 0x0c, 0xba, 0x0e, 0x21, 0xbc, 0xb1, 0x44,
+  0xa0, 0x21, 0x2a, 0x61, 0x12, 0x48, 0x10, 0xca, 0xa1, 0x97, 0x83, 0x19, 0x68, 0xa1, 0x90, 0x11,
+};
+
+const audio_sample_t snd_hit = {AUDIO_ADPCM4, 4000, snd_hit_data};
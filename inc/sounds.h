@@ -0,0 +1,11 @@
+// Gerado por host/wav2c.py - não editar
+#ifndef SOUNDS_H
+#define SOUNDS_H
+
+#include "audio.h"
+
+extern const audio_sample_t snd_laser; // pcm8, 2560 amostras, 2560 bytes
+extern const audio_sample_t snd_explosion; // adpcm, 8000 amostras, 4000 bytes
+extern const audio_sample_t snd_hit; // adpcm, 4000 amostras, 2000 bytes
+
+#endif
@@ -1,74 +1,245 @@
+#include <string.h>
 #include "ssd1306.h"
 #include "font.h"
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+// As rotinas de desenho rodam a cada quadro e ficam na SRAM (__not_in_flash_func)
+// para não sofrer com falhas de cache do XIP. A fonte já fica na RAM por não ser const.
+
+// O envio é assíncrono pelo escalonador de I2C: comandos saem em lotes (uma
+// transação com prefixo 0x00) e os dados em blocos de SSD1306_CHUNK bytes com
+// o prefixo 0x40 repetido, entre os quais transações mais urgentes de outros
+// dispositivos podem passar. As transações do display são atendidas em ordem.
+
+static const uint8_t ssd1306_cmd_prefix = 0x00;
+static const uint8_t ssd1306_data_prefix = 0x40;
+
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_sched_t *bus) {
   ssd->width = width;
   ssd->height = height;
   ssd->pages = height / 8U;
   ssd->address = address;
-  ssd->i2c_port = i2c;
+  ssd->bus = bus;
   ssd->bufsize = ssd->pages * ssd->width + 1;
-  ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  hard_assert(ssd->bufsize <= SSD1306_BUFFER_SIZE);
+  memset(ssd->ram_buffer, 0, ssd->bufsize);
   ssd->ram_buffer[0] = 0x40;
-  ssd->port_buffer[0] = 0x80;
+  ssd->area_buffer[0] = 0x40;
+  ssd->scroll_active = false;
+  ssd->scroll_running = false;
+  ssd->scroll_pauses = ssd->scroll_resume_pause = 0;
+  memset(ssd->cmds, 0, sizeof(ssd->cmds));
+  memset(ssd->areas, 0, sizeof(ssd->areas));
+  ssd->area_count = 0;
+  ssd->area_used = 0;
+  i2c_sched_add_device(bus, &ssd->device, address, SSD1306_I2C_PRIORITY);
 }
 
 void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  const uint8_t config[] = {
+    SET_DISP | 0x00,
+    SET_MEM_ADDR, 0x01,
+    SET_DISP_START_LINE | 0x00,
+    SET_SEG_REMAP | 0x01,
+    SET_MUX_RATIO, HEIGHT - 1,
+    SET_COM_OUT_DIR | 0x08,
+    SET_DISP_OFFSET, 0x00,
+    SET_COM_PIN_CFG, 0x12,
+    SET_DISP_CLK_DIV, 0x80,
+    SET_PRECHARGE, 0xF1,
+    SET_VCOM_DESEL, 0x30,
+    SET_CONTRAST, 0xFF,
+    SET_ENTIRE_ON,
+    SET_NORM_INV,
+    SET_CHARGE_PUMP, 0x14,
+    SET_DISP | 0x01,
+  };
+  ssd1306_commands(ssd, config, sizeof(config));
+}
+
+// Enfileira um lote de comandos. Os bytes são copiados para um dos lotes
+// livres; se todos estiverem em voo, espera o mais antigo terminar. 'done'
+// (ou NULL) é chamada na interrupção quando o lote chega ao display.
+static void ssd1306_queue(ssd1306_t *ssd, const uint8_t *commands, uint8_t count,
+                          void (*done)(i2c_txn_t *txn, void *ctx)) {
+  hard_assert(count <= SSD1306_CMD_MAX);
+  ssd1306_cmd_t *slot = NULL;
+  while (!slot) {
+    for (uint8_t i = 0; i < SSD1306_CMD_SLOTS && !slot; ++i)
+      if (!i2c_txn_busy(&ssd->cmds[i].txn))
+        slot = &ssd->cmds[i];
+    if (!slot)
+      tight_loop_contents();
+  }
+
+  memcpy(slot->bytes, commands, count);
+  i2c_txn_init(&slot->txn, &ssd->device, &ssd1306_cmd_prefix, 1, slot->bytes, count, 0);
+  slot->txn.done = done;
+  slot->txn.ctx = ssd;
+  i2c_sched_submit(ssd->bus, &slot->txn);
+}
+
+void ssd1306_commands(ssd1306_t *ssd, const uint8_t *commands, uint8_t count) {
+  ssd1306_queue(ssd, commands, count, NULL);
+}
+
+// A rolagem voltou a correr no controlador: conta o tempo a partir daqui,
+// a menos que outra pausa já tenha sido enfileirada depois desta retomada
+static void ssd1306_scroll_resumed(i2c_txn_t *txn, void *ctx) {
+  ssd1306_t *ssd = ctx;
+  if (ssd->scroll_pauses != ssd->scroll_resume_pause)
+    return;
+  ssd->scroll_resumed_us = time_us_32();
+  ssd->scroll_running = true;
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
-  ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->port_buffer,
-    2,
-    false
-  );
+  ssd1306_commands(ssd, &command, 1);
+}
+
+// Espera o envio de retângulos anterior terminar de usar area_buffer
+static void ssd1306_area_wait(ssd1306_t *ssd) {
+  for (uint8_t i = 0; i < SSD1306_AREA_SLOTS; ++i) {
+    i2c_txn_wait(&ssd->areas[i].window);
+    i2c_txn_wait(&ssd->areas[i].data);
+  }
+}
+
+// Espera todas as transações do display terminarem
+void ssd1306_wait(ssd1306_t *ssd) {
+  ssd1306_area_wait(ssd);
+  for (uint8_t i = 0; i < SSD1306_CMD_SLOTS; ++i)
+    i2c_txn_wait(&ssd->cmds[i].txn);
+}
+
+// Reprograma e liga a rolagem contínua com a configuração guardada em ssd
+static void ssd1306_scroll_resume(ssd1306_t *ssd) {
+  uint8_t commands[11];
+  uint8_t n = 0;
+  commands[n++] = SET_VERT_SCROLL_AREA;
+  commands[n++] = ssd->scroll_fixed_rows;
+  commands[n++] = ssd->scroll_rows;
+  if (ssd->scroll_v_offset) {
+    commands[n++] = SET_VERT_HORIZ_SCROLL_RIGHT;
+    commands[n++] = 0x00;
+    commands[n++] = ssd->scroll_start_page;
+    commands[n++] = ssd->scroll_interval;
+    commands[n++] = ssd->scroll_end_page;
+    commands[n++] = ssd->scroll_v_offset;
+  } else {
+    commands[n++] = SET_HORIZ_SCROLL_RIGHT;
+    commands[n++] = 0x00;
+    commands[n++] = ssd->scroll_start_page;
+    commands[n++] = ssd->scroll_interval;
+    commands[n++] = ssd->scroll_end_page;
+    commands[n++] = 0x00;
+    commands[n++] = 0xFF;
+  }
+  commands[n++] = SET_SCROLL_ON;
+  ssd->scroll_resume_pause = ssd->scroll_pauses;
+  ssd1306_queue(ssd, commands, n, ssd1306_scroll_resumed);
+}
+
+// O datasheet exige desligar a rolagem (0x2E) antes de escrever na GDDRAM ou
+// reconfigurar a rolagem. Retorna true se ela estava ligada e deve ser retomada.
+static bool ssd1306_scroll_pause(ssd1306_t *ssd) {
+  if (!ssd->scroll_active)
+    return false;
+  ssd->scroll_running = false;
+  ssd->scroll_pauses++;
+  ssd1306_command(ssd, SET_SCROLL_OFF);
+  return true;
+}
+
+void ssd1306_scroll_start(ssd1306_t *ssd, uint8_t fixed_rows, uint8_t scroll_rows, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval, uint8_t v_offset) {
+  ssd1306_scroll_pause(ssd);
+  ssd->scroll_fixed_rows = fixed_rows;
+  ssd->scroll_rows = scroll_rows;
+  ssd->scroll_start_page = start_page;
+  ssd->scroll_end_page = end_page;
+  ssd->scroll_interval = interval;
+  ssd->scroll_v_offset = v_offset;
+  ssd1306_scroll_resume(ssd);
+  ssd->scroll_active = true;
+}
+
+void ssd1306_scroll_stop(ssd1306_t *ssd) {
+  ssd1306_scroll_pause(ssd);
+  ssd->scroll_active = false;
 }
 
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
-  );
-}
-
-void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+  ssd1306_send_area(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+}
+
+// Inicia um envio de retângulos. No modo de endereçamento vertical o buffer é
+// coluna a coluna, então cada retângulo é copiado para area_buffer (só espera
+// se o envio anterior ainda estiver em voo) e as funções retornam enquanto o
+// escalonador transmite. Com a rolagem ligada, ela é pausada (0x2E) antes do
+// primeiro acesso à GDDRAM e retomada em ssd1306_area_end, como exige o datasheet.
+void ssd1306_area_begin(ssd1306_t *ssd) {
+  ssd1306_area_wait(ssd);
+  ssd->area_count = 0;
+  ssd->area_used = 0;
+  ssd1306_scroll_pause(ssd);
+}
+
+// Indica se uma escrita na GDDRAM pode começar sem travar a rolagem: ela
+// precisa correr por SSD1306_SCROLL_RUN_US entre duas pausas, senão o passo
+// do controlador (2 quadros ou mais) nunca se completa e as estrelas param.
+bool ssd1306_area_ready(ssd1306_t *ssd) {
+  if (!ssd->scroll_active)
+    return true;
+  return ssd->scroll_running && time_us_32() - ssd->scroll_resumed_us >= SSD1306_SCROLL_RUN_US;
+}
+
+// Acrescenta ao envio o retângulo de colunas x0..x1 e páginas first_page..last_page
+void ssd1306_area_add(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t first_page, uint8_t last_page) {
+  hard_assert(ssd->area_count < SSD1306_AREA_SLOTS);
+  ssd1306_area_t *area = &ssd->areas[ssd->area_count++];
+
+  uint8_t count = last_page - first_page + 1;
+  hard_assert(ssd->area_used + (x1 - x0 + 1) * count < SSD1306_BUFFER_SIZE); // Antes de copiar
+  uint8_t *start = &ssd->area_buffer[1 + ssd->area_used];
+  uint8_t *out = start;
+  for (uint8_t x = x0; x <= x1; ++x) {
+    memcpy(out, &ssd->ram_buffer[1 + x * ssd->pages + first_page], count);
+    out += count;
+  }
+  ssd->area_used += out - start;
+
+  area->window_bytes[0] = SET_COL_ADDR;
+  area->window_bytes[1] = x0;
+  area->window_bytes[2] = x1;
+  area->window_bytes[3] = SET_PAGE_ADDR;
+  area->window_bytes[4] = first_page;
+  area->window_bytes[5] = last_page;
+  i2c_txn_init(&area->window, &ssd->device, &ssd1306_cmd_prefix, 1, area->window_bytes,
+               sizeof(area->window_bytes), 0);
+  i2c_sched_submit(ssd->bus, &area->window);
+
+  i2c_txn_init(&area->data, &ssd->device, &ssd1306_data_prefix, 1, start, out - start, SSD1306_CHUNK);
+  i2c_sched_submit(ssd->bus, &area->data);
+}
+
+// Fecha o envio: religa a rolagem depois do último retângulo (a fila do display é em ordem)
+void ssd1306_area_end(ssd1306_t *ssd) {
+  if (ssd->scroll_active)
+    ssd1306_scroll_resume(ssd);
+}
+
+// Envia apenas o retângulo de colunas x0..x1 e páginas first_page..last_page
+void ssd1306_send_area(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t first_page, uint8_t last_page) {
+  ssd1306_area_begin(ssd);
+  ssd1306_area_add(ssd, x0, x1, first_page, last_page);
+  ssd1306_area_end(ssd);
+}
+
+// Envia apenas as páginas first_page..last_page (ex.: o HUD), sem retransmitir o quadro todo
+void ssd1306_send_pages(ssd1306_t *ssd, uint8_t first_page, uint8_t last_page) {
+  ssd1306_send_area(ssd, 0, ssd->width - 1, first_page, last_page);
+}
+
+void __not_in_flash_func(ssd1306_pixel)(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
   uint16_t index = (y >> 3) + (x << 3) + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
@@ -77,25 +248,12 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
-
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
-    }
+void __not_in_flash_func(ssd1306_fill)(ssd1306_t *ssd, bool value) {
+  // Preenche o buffer inteiro de uma vez, preservando o byte de controle
+  memset(&ssd->ram_buffer[1], value ? 0xFF : 0x00, ssd->bufsize - 1);
 }
 
-
-
-void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
+void __not_in_flash_func(ssd1306_rect)(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
   for (uint8_t x = left; x < left + width; ++x) {
     ssd1306_pixel(ssd, x, top, value);
     ssd1306_pixel(ssd, x, top + height - 1, value);
@@ -114,7 +272,7 @@ void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint
   }
 }
 
-void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
+void __not_in_flash_func(ssd1306_line)(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
     int dx = abs(x1 - x0);
     int dy = abs(y1 - y0);
 
@@ -143,18 +301,18 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 }
 
 
-void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
+void __not_in_flash_func(ssd1306_hline)(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
   for (uint8_t x = x0; x <= x1; ++x)
     ssd1306_pixel(ssd, x, y, value);
 }
 
-void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+void __not_in_flash_func(ssd1306_vline)(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
   for (uint8_t y = y0; y <= y1; ++y)
     ssd1306_pixel(ssd, x, y, value);
 }
 
 // Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+void __not_in_flash_func(ssd1306_draw_char)(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
 {
   uint16_t index = 0;
   char ver=c;
@@ -177,7 +335,7 @@ void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
 }
 
 // Função para desenhar uma string
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
+void __not_in_flash_func(ssd1306_draw_string)(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
 {
   while (*str)
   {
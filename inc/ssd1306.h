@@ -1,9 +1,20 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "i2c_sched.h"
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_BUFFER_SIZE (WIDTH * HEIGHT / 8 + 1) // Framebuffer estático + byte de controle
+#define SSD1306_I2C_PRIORITY 8     // Prioridade no barramento (sensores pequenos passam à frente)
+#define SSD1306_CHUNK 32           // Bytes de dados por bloco I2C (~0,8 ms a 400 kHz)
+#define SSD1306_CMD_SLOTS 4        // Lotes de comandos em voo
+#define SSD1306_SCROLL_RUN_US 30000 // Rolagem ligada entre escritas na GDDRAM (~3 quadros do display)
+#define SSD1306_AREA_SLOTS 8       // Retângulos por envio (um por página no campo de jogo)
+#define SSD1306_CMD_MAX 32         // Bytes por lote de comandos
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -22,22 +33,77 @@ typedef enum {
   SET_DISP_CLK_DIV = 0xD5,
   SET_PRECHARGE = 0xD9,
   SET_VCOM_DESEL = 0xDB,
-  SET_CHARGE_PUMP = 0x8D
+  SET_CHARGE_PUMP = 0x8D,
+  SET_HORIZ_SCROLL_RIGHT = 0x26,
+  SET_HORIZ_SCROLL_LEFT = 0x27,
+  SET_VERT_HORIZ_SCROLL_RIGHT = 0x29,
+  SET_VERT_HORIZ_SCROLL_LEFT = 0x2A,
+  SET_SCROLL_OFF = 0x2E,
+  SET_SCROLL_ON = 0x2F,
+  SET_VERT_SCROLL_AREA = 0xA3
 } ssd1306_command_t;
 
+// Intervalo entre passos da rolagem, em quadros do controlador (valores do datasheet)
+typedef enum {
+  SCROLL_2_FRAMES = 0x07,
+  SCROLL_3_FRAMES = 0x04,
+  SCROLL_4_FRAMES = 0x05,
+  SCROLL_5_FRAMES = 0x00,
+  SCROLL_25_FRAMES = 0x06,
+  SCROLL_64_FRAMES = 0x01,
+  SCROLL_128_FRAMES = 0x02,
+  SCROLL_256_FRAMES = 0x03
+} ssd1306_scroll_interval_t;
+
+// Lote de comandos enviado em uma única transação (prefixo 0x00)
+typedef struct {
+  i2c_txn_t txn;
+  uint8_t bytes[SSD1306_CMD_MAX];
+} ssd1306_cmd_t;
+
+// Retângulo de um envio: janela de endereços (0x21/0x22) e os dados
+typedef struct {
+  i2c_txn_t window;
+  uint8_t window_bytes[6];
+  i2c_txn_t data;
+} ssd1306_area_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
-  i2c_inst_t *i2c_port;
+  i2c_sched_t *bus;
+  i2c_device_t device;                      // Fila e contadores de uso do barramento
   bool external_vcc;
-  uint8_t *ram_buffer;
+  uint8_t ram_buffer[SSD1306_BUFFER_SIZE];
   size_t bufsize;
-  uint8_t port_buffer[2];
+  ssd1306_cmd_t cmds[SSD1306_CMD_SLOTS];
+  uint8_t area_buffer[SSD1306_BUFFER_SIZE]; // Cópia das páginas em envio (o desenho segue no ram_buffer)
+  ssd1306_area_t areas[SSD1306_AREA_SLOTS];
+  uint8_t area_count;                       // Retângulos no envio atual
+  uint16_t area_used;                       // Bytes ocupados em area_buffer
+  bool scroll_active;                       // Rolagem contínua do controlador ligada
+  uint8_t scroll_fixed_rows, scroll_rows;   // Área de rolagem vertical (0xA3)
+  uint8_t scroll_start_page, scroll_end_page, scroll_interval, scroll_v_offset;
+  volatile bool scroll_running;             // 0x2F já chegou ao controlador (callback do I2C)
+  volatile uint32_t scroll_resumed_us;
+  volatile uint16_t scroll_pauses;          // Pausas enfileiradas (descarta retomadas antigas)
+  uint16_t scroll_resume_pause;             // Valor de scroll_pauses na última retomada
 } ssd1306_t;
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_sched_t *bus);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_commands(ssd1306_t *ssd, const uint8_t *commands, uint8_t count);
+void ssd1306_wait(ssd1306_t *ssd);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_pages(ssd1306_t *ssd, uint8_t first_page, uint8_t last_page);
+void ssd1306_send_area(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t first_page, uint8_t last_page);
+bool ssd1306_area_ready(ssd1306_t *ssd);
+void ssd1306_area_begin(ssd1306_t *ssd);
+void ssd1306_area_add(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t first_page, uint8_t last_page);
+void ssd1306_area_end(ssd1306_t *ssd);
+
+void ssd1306_scroll_start(ssd1306_t *ssd, uint8_t fixed_rows, uint8_t scroll_rows, uint8_t start_page, uint8_t end_page, ssd1306_scroll_interval_t interval, uint8_t v_offset);
+void ssd1306_scroll_stop(ssd1306_t *ssd);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -46,4 +112,6 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+
+#endif
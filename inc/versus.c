@@ -0,0 +1,36 @@
+#include "versus.h"
+#include "link.h"
+
+void versus_init(versus_t *v) {
+  v->lane[0] = v->lane[1] = 3;
+  v->score[0] = v->score[1] = 0;
+  v->hit[0] = v->hit[1] = false;
+  v->checksum = 0;
+}
+
+void versus_step(versus_t *v, uint8_t input0, uint8_t input1) {
+  uint8_t inputs[2] = {input0, input1};
+
+  for (uint8_t p = 0; p < 2; ++p) {
+    uint8_t lane = inputs[p] & LINK_INPUT_LANE;
+    if (lane >= 1 && lane <= 5)
+      v->lane[p] = lane;
+  }
+
+  // Mesma regra do jogo local: acerta se o adversário estiver a até uma posição
+  int8_t distance = (int8_t)v->lane[0] - (6 - (int8_t)v->lane[1]);
+  bool aligned = distance >= -1 && distance <= 1;
+
+  for (uint8_t p = 0; p < 2; ++p) {
+    v->hit[1 - p] = aligned && (inputs[p] & LINK_INPUT_FIRE);
+    if (v->hit[1 - p])
+      v->score[p]++;
+  }
+
+  // FNV-1a sobre o estado
+  uint8_t state[6] = {v->lane[0], v->lane[1], v->score[0], v->score[0] >> 8, v->score[1], v->score[1] >> 8};
+  uint32_t hash = v->checksum ^ 2166136261u;
+  for (uint8_t i = 0; i < sizeof(state); ++i)
+    hash = (hash ^ state[i]) * 16777619u;
+  v->checksum = hash;
+}
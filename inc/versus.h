@@ -0,0 +1,22 @@
+#ifndef VERSUS_H
+#define VERSUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Regras do modo versus. São determinísticas e dependem só das entradas do
+// tick, então as duas placas em lockstep chegam sempre ao mesmo estado.
+// O jogador 0 fica embaixo e o jogador 1 em cima; cada um informa a posição
+// (1 a 5) vista do seu lado, por isso a posição do jogador 1 é espelhada.
+
+typedef struct {
+  uint8_t lane[2];     // Posição de cada jogador, vista do próprio lado
+  uint16_t score[2];   // Acertos de cada jogador
+  bool hit[2];         // Jogador atingido neste tick
+  uint32_t checksum;   // Resumo do estado, para comparar as duas placas
+} versus_t;
+
+void versus_init(versus_t *v);
+void versus_step(versus_t *v, uint8_t input0, uint8_t input1);
+
+#endif
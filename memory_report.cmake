@@ -0,0 +1,122 @@
+# Relatório de memória do firmware (executado após cada link)
+#
+# Uso: cmake -DELF=<arquivo.elf> -DNM=<arm-none-eabi-nm> -DREPORT=<saida.txt>
+#            -DRAM_BUDGET=<bytes> -DFLASH_BUDGET=<bytes>
+#            "-DHOT_SYMBOLS=a;b;c" -P memory_report.cmake
+#
+# Gera a lista de símbolos por tamanho com a região onde cada um foi colocado,
+# soma o uso de RAM/flash e interrompe o build se um orçamento for estourado
+# ou se alguma função crítica (HOT_SYMBOLS) tiver voltado para a flash (XIP).
+# O firmware não usa heap: o build também falha se o alocador for ligado.
+
+foreach(var ELF NM REPORT RAM_BUDGET FLASH_BUDGET)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "memory_report: variável ${var} não definida")
+    endif()
+endforeach()
+
+# Endereços do RP2040 (decimal): flash XIP em 0x10000000, SRAM em 0x20000000
+set(FLASH_BASE 268435456)
+set(FLASH_END  285212672)
+set(RAM_BASE   536870912)
+set(RAM_END    537141248)
+
+execute_process(
+    COMMAND ${NM} --print-size --size-sort --reverse-sort --radix=d ${ELF}
+    OUTPUT_VARIABLE nm_output
+    RESULT_VARIABLE nm_result
+)
+if(NOT nm_result EQUAL 0)
+    message(FATAL_ERROR "memory_report: falha ao executar ${NM}")
+endif()
+
+string(REPLACE "\n" ";" nm_lines "${nm_output}")
+
+# Flash ocupada = fim da imagem gravada (__flash_binary_end, definido pelo
+# linker script do SDK). Inclui as cópias de carga de .data e do código que
+# roda na SRAM, que não aparecem somando os símbolos com endereço na XIP.
+execute_process(
+    COMMAND ${NM} --radix=d ${ELF}
+    OUTPUT_VARIABLE nm_all
+    RESULT_VARIABLE nm_result
+)
+if(NOT nm_result EQUAL 0)
+    message(FATAL_ERROR "memory_report: falha ao executar ${NM}")
+endif()
+if(NOT nm_all MATCHES "(^|\n)0*([0-9]+) [A-Za-z] __flash_binary_end\n")
+    message(FATAL_ERROR "memory_report: símbolo __flash_binary_end não encontrado em ${ELF}")
+endif()
+math(EXPR flash_total "${CMAKE_MATCH_2} - ${FLASH_BASE}")
+
+set(ram_total 0)
+set(ram_code 0)
+set(lines "")
+set(ram_symbols "")
+
+foreach(line IN LISTS nm_lines)
+    if(NOT line MATCHES "^0*([0-9]+) 0*([0-9]+) ([A-Za-z]) (.+)$")
+        continue()
+    endif()
+    set(addr ${CMAKE_MATCH_1})
+    set(size ${CMAKE_MATCH_2})
+    set(type ${CMAKE_MATCH_3})
+    set(name ${CMAKE_MATCH_4})
+
+    if(addr GREATER_EQUAL RAM_BASE AND addr LESS RAM_END)
+        set(region "RAM")
+        math(EXPR ram_total "${ram_total} + ${size}")
+        if(type MATCHES "^[Tt]$")
+            math(EXPR ram_code "${ram_code} + ${size}")
+        endif()
+        list(APPEND ram_symbols ${name})
+    elseif(addr GREATER_EQUAL FLASH_BASE AND addr LESS FLASH_END)
+        set(region "FLASH")
+    else()
+        set(region "OTHER")
+    endif()
+
+    string(APPEND lines "${region}\t${size}\t${type}\t${name}\n")
+endforeach()
+
+file(WRITE ${REPORT}
+    "# Orçamento de memória: ${ELF}\n"
+    "# RAM:   ${ram_total} / ${RAM_BUDGET} bytes (código na RAM: ${ram_code} bytes)\n"
+    "# FLASH: ${flash_total} / ${FLASH_BUDGET} bytes\n"
+    "# região\ttamanho\ttipo\tsímbolo\n"
+    "${lines}"
+)
+
+message(STATUS "Memória: RAM ${ram_total}/${RAM_BUDGET} bytes (código ${ram_code}), FLASH ${flash_total}/${FLASH_BUDGET} bytes -> ${REPORT}")
+
+set(failed FALSE)
+
+foreach(symbol IN LISTS HOT_SYMBOLS)
+    list(FIND ram_symbols ${symbol} index)
+    if(index EQUAL -1)
+        message(SEND_ERROR "memory_report: ${symbol} não está na SRAM")
+        set(failed TRUE)
+    endif()
+endforeach()
+
+# malloc e companhia só entram na imagem se algo os chamar (--gc-sections);
+# __wrap_* são os do SDK (pico_malloc) e _*_r os do newlib
+foreach(symbol malloc calloc realloc _sbrk __wrap_malloc __wrap_calloc __wrap_realloc _malloc_r _calloc_r)
+    if(nm_all MATCHES "(^|\n)[0-9]+ [A-Za-z] ${symbol}\n")
+        message(SEND_ERROR "memory_report: ${symbol} está na imagem (o firmware não deve usar heap)")
+        set(failed TRUE)
+    endif()
+endforeach()
+
+if(ram_total GREATER RAM_BUDGET)
+    message(SEND_ERROR "memory_report: RAM estática (${ram_total}) excede o orçamento (${RAM_BUDGET})")
+    set(failed TRUE)
+endif()
+
+if(flash_total GREATER FLASH_BUDGET)
+    message(SEND_ERROR "memory_report: flash (${flash_total}) excede o orçamento (${FLASH_BUDGET})")
+    set(failed TRUE)
+endif()
+
+if(failed)
+    message(FATAL_ERROR "memory_report: verifique ${REPORT}")
+endif()